@@ -23,6 +23,8 @@
 <ul>
 <li>Use compiler-injected device topology defines in place of hand-maintained macros</li>
 <li>Fix stack overflow in int32 x int16 conv_corr</li>
+<li>sync: Add aie::pipeline to run kernels over synchronized buffers</li>
+<li>sync: Support several readers and writers in producer_sem and consumer_sem, and forward them from buffered_input and buffered_output</li>
 </ul>
 
 <h3>Changes to data types</h3>
@@ -65,6 +67,30 @@
 <li>sliding_mul_ch: Native path fix</li>
 <li>sliding_mul_ch: Add set_convo_mode call to 32-channel cases</li>
 <li>set_convo_mode: Remove implicit set_convo_mode calls; callers must now set the mode explicitly</li>
+<li>fft: Add aie::fft_plan, which selects the stage sequence and generates the twiddle tables at compile time</li>
+<li>fft: Document placement of odd-radix stages at any position of mixed-radix transforms</li>
+<li>fft: Add fft_dit_r*_stage_batched functions for batches of interleaved transforms</li>
+<li>fft: Add windowed first stages and output epilogues (squared magnitude, block exponent) for FFT stages</li>
+<li>fft: Add aie::rfft_plan and aie::irfft_plan for transforms of real signals</li>
+<li>fft: Add aie::fft_plan::run_block_floating_point, which chooses the shift of each stage from the measured headroom and returns the block exponent</li>
+<li>mmul: Add aie::gemm, a driver for tiled matrix multiplications that chooses the mmul shape and the accumulator grid for the target architecture</li>
+<li>mmul: Add epilogues to aie::gemm, applied to each output tile before it is stored, and aie::gemm_requantize_epilogue for fused bias, scale and activation</li>
+<li>sparse_vector: Add aie::sparse_pack, which converts dense data to the layout read by sparse vector buffer streams and validates the sparsity constraint</li>
+<li>sliding_mul: Add aie::fir, a streaming FIR filter that keeps its history across calls and splits any number of taps into sliding multiplications that minimize the idle multipliers</li>
+<li>sliding_mul: Add aie::fir_decimator and aie::fir_interpolator, polyphase FIR filters that change the sample rate by a power of two</li>
+<li>sliding_mul: Add aie::fir_sym, aie::fir_for and aie::make_fir, which detect symmetric and antisymmetric coefficients at compile time and fold them with sliding_mul_sym_ops on AIE</li>
+<li>sliding_mul: Add aie::cascade_fir, which splits a streaming FIR filter across a chain of kernels connected by cascade streams</li>
+<li>sliding_mul: Add aie::correlator, a streaming correlator that reports the samples whose squared magnitude reaches a threshold and tracks the peak in a single pass</li>
+<li>cfr: Add support for AIE-ML, XDNA2 and AIE-MLv2, and a find_peak helper based on abs_square and a max reduction</li>
+<li>sincos: Add aie::nco, a numerically controlled oscillator that generates blocks of rotations and mixes them with a signal on all architectures</li>
+<li>sliding_mul: Add aie::biquad_cascade, a cascade of IIR second-order sections computed in blocks with sliding multiplications</li>
+<li>fft: Add aie::channelizer, a polyphase filter bank whose filters are fused into the first stage of an inverse fft_plan</li>
+<li>mmul: Add aie::conv2d, a 2D convolution that loads the tiles of the im2col matrix directly from NHWC or channel-blocked tensors and supports gemm epilogues</li>
+<li>exp2: Add aie::softmax and aie::log_softmax, which compute a numerically stable softmax of a row in two passes with an online maximum on XDNA2 and AIE-MLv2</li>
+<li>normalization: Add aie::layer_norm and aie::rms_norm, which normalize a row of bfloat16 values with single-pass statistics and a fused gamma/beta transform on AIE-ML, XDNA2 and AIE-MLv2</li>
+<li>lut: Add aie::activation::gelu, silu, sigmoid and erf for int8, int16 and bfloat16, with lookup tables generated at compile time and documented maximum errors</li>
+<li>lut: Add AIE implementations of aie::parallel_lookup and aie::linear_approx, which gather with scalar loads from tables for 1, 2 or 4 parallel accesses, and enable the int8 and int16 aie::activation functions on AIE</li>
+<li>lut: Add aie::make_lut, which samples a function at compile time and returns an aie::lut_table with the values or slope/offset pairs quantized and laid out for 1, 2 or 4 parallel accesses, and use it for the aie::activation tables</li>
 
 </ul>
 
@@ -0,0 +1,33 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2022 Xilinx, Inc.
+// Copyright (C) 2022-2026 Advanced Micro Devices, Inc.
+
+#include <aie_api/aie.hpp>
+
+//![Activations]
+// Feed-forward block activation on bfloat16 values. The lookup table is generated at compile time.
+void ffn_activation(const bfloat16 * __restrict in, bfloat16 * __restrict out, unsigned n)
+{
+    aie::activation::gelu<bfloat16> gelu;
+
+    gelu.run(in, out, n);
+}
+
+// Gating of a quantized model: sigmoid of Q3.12 values, with Q0.15 outputs, multiplied by the gated values
+void sigmoid_gate(const int16 * __restrict gate, const int16 * __restrict x, int16 * __restrict out, unsigned n)
+{
+    aie::activation::sigmoid<int16> sigmoid;
+
+    using sigmoid_t = decltype(sigmoid);
+
+    for (unsigned i = 0; i < n / sigmoid_t::lanes; ++i) {
+        const aie::vector<int16, sigmoid_t::lanes> g = sigmoid.compute(aie::load_v<sigmoid_t::lanes>(gate));
+
+        aie::store_v(out, aie::mul(g, aie::load_v<sigmoid_t::lanes>(x)).to_vector<int16>(15));
+
+        gate += sigmoid_t::lanes;
+        x    += sigmoid_t::lanes;
+        out  += sigmoid_t::lanes;
+    }
+}
+//![Activations]
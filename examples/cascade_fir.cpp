@@ -0,0 +1,35 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2022 Xilinx, Inc.
+// Copyright (C) 2022-2026 Advanced Micro Devices, Inc.
+
+#include <aie_api/aie.hpp>
+#include <aie_api/adf/stream.hpp>
+
+//![Cascade FIR]
+constexpr unsigned Taps  = 512;
+constexpr unsigned Tiles = 4;
+constexpr unsigned Lanes = 8;
+
+template <unsigned Tile>
+using fir_t = aie::cascade_fir<Taps, Tiles, Tile, Lanes, cint16, cint16, cacc64>;
+
+// All kernels receive the same input samples and the coefficients of the whole filter. Each one keeps its own slice.
+void fir_first(fir_t<0> &fir, const cint16 *in, output_cascade<cacc64> &cout, unsigned frame_size)
+{
+    fir.run(in, cout, frame_size);
+}
+
+template <unsigned Tile>
+void fir_middle(fir_t<Tile> &fir, const cint16 *in, input_cascade<cacc64> &cin, output_cascade<cacc64> &cout, unsigned frame_size)
+{
+    fir.run(in, cin, cout, frame_size);
+}
+
+template void fir_middle<1>(fir_t<1> &, const cint16 *, input_cascade<cacc64> &, output_cascade<cacc64> &, unsigned);
+template void fir_middle<2>(fir_t<2> &, const cint16 *, input_cascade<cacc64> &, output_cascade<cacc64> &, unsigned);
+
+void fir_last(fir_t<Tiles - 1> &fir, const cint16 *in, input_cascade<cacc64> &cin, cint16 *out, unsigned frame_size, int shift)
+{
+    fir.run(in, cin, out, frame_size, shift);
+}
+//![Cascade FIR]
@@ -0,0 +1,19 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2022 Xilinx, Inc.
+// Copyright (C) 2022-2026 Advanced Micro Devices, Inc.
+
+#include <aie_api/aie.hpp>
+
+//![Channelizer]
+// Splits the input into 32 channels with a prototype filter of 32 * 8 taps
+using channelizer_t = aie::channelizer<32, 8, cint16>;
+
+void channelize(channelizer_t &ch, const cint16 * __restrict in, unsigned frame_size, cint16 * __restrict out)
+{
+    alignas(aie::vector_decl_align) static cint16 tmp[channelizer_t::scratch_size];
+
+    // Each group of 32 input samples produces one sample of each channel. The phase filters are computed in the first
+    // stage of the transform, so their outputs never go through memory.
+    ch.run(in, frame_size, 0, tmp, out);
+}
+//![Channelizer]
@@ -51,6 +51,67 @@ void fft_512pt(const cint16 * __restrict x,  // Input pointer
 //![512p FFT]
 
 
+//![FFT plan]
+void fft_512pt_plan(const cint16 * __restrict x, bool inv, cint16 * __restrict y)
+{
+    using plan = aie::fft_plan<512, cint16>;
+
+    // Scratch space for intermediate results
+    alignas(aie::vector_decl_align) static cint16 tmp[plan::scratch_size];
+
+    // Twiddles are generated at compile time, no additional shift is applied to the stage outputs
+    plan::run(x, 0, inv, tmp, y);
+}
+//![FFT plan]
+
+// Block floating point FFTs are available on AIE and AIE-ML
+#if __AIE_ARCH__ == 10 || __AIE_ARCH__ == 20
+//![Block floating point FFT]
+unsigned fft_1024pt_bfp(const cint16 * __restrict x, bool inv, cint16 * __restrict y)
+{
+    // 1024 = 4^5: five radix-4 stages, which take the block exponent measured on the outputs of the previous stage
+    using plan = aie::fft_plan<1024, cint16>;
+
+    static_assert(plan::num_stages == 5);
+    static_assert(plan::radix(0) == 4 && plan::radix(1) == 4 && plan::radix(2) == 4 &&
+                  plan::radix(3) == 4 && plan::radix(4) == 4);
+
+    alignas(aie::vector_decl_align) static cint16 tmp[plan::scratch_size];
+
+    // fft(x) = y * 2^exponent
+    return plan::run_block_floating_point(x, 0, inv, tmp, y);
+}
+//![Block floating point FFT]
+#endif
+
+//![Mixed-radix FFT]
+void fft_1536pt(const cint16 * __restrict x, bool inv, cint16 * __restrict y)
+{
+    // 1536 = 3 * 2 * 4^4. The radix 3 stage runs first, so that its vectorization (512) is large enough for the
+    // odd-radix stage implementations. No padding to 2048 points is required.
+    using plan = aie::fft_plan<1536, cint16>;
+
+    static_assert(plan::radix(0) == 3);
+
+    alignas(aie::vector_decl_align) static cint16 tmp[plan::scratch_size];
+
+    plan::run(x, 0, inv, tmp, y);
+}
+//![Mixed-radix FFT]
+
+//![Real FFT]
+void power_spectrum_1024(const int16 * __restrict samples, cint16 * __restrict spectrum)
+{
+    // 1024 real samples are transformed as 512 complex values, followed by a split pass
+    using plan = aie::rfft_plan<1024, int16>;
+
+    alignas(aie::vector_decl_align) static cint16 tmp[plan::scratch_size];
+
+    // spectrum[0] holds the DC bin in the real part and the Nyquist bin in the imaginary part
+    plan::run(samples, 0, tmp, spectrum);
+}
+//![Real FFT]
+
 bool fft_complete() {
     //![FFT complete example]
     constexpr unsigned        n = 128;
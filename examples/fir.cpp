@@ -0,0 +1,62 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2022 Xilinx, Inc.
+// Copyright (C) 2022-2026 Advanced Micro Devices, Inc.
+
+#include <aie_api/aie.hpp>
+
+//![Streaming FIR]
+constexpr unsigned Taps  = 70;
+constexpr unsigned Lanes = 16;
+
+using fir_t = aie::fir<Taps, Lanes, int16, int16>;
+
+// The filter keeps the last Taps - 1 samples, so consecutive frames are filtered as a continuous signal
+void fir_int16(fir_t &fir, const int16 *in, int16 *out, unsigned frame_size, int shift)
+{
+    fir.run(in, out, frame_size, shift);
+}
+//![Streaming FIR]
+
+//![Polyphase FIR]
+// Decimation by 4: each call consumes 4 * 16 input samples and produces 16 outputs
+using decimator_t = aie::fir_decimator<Taps, 4, Lanes, int16, int16>;
+
+void decimate_int16(decimator_t &fir, const int16 *in, int16 *out, unsigned frame_size, int shift)
+{
+    fir.run(in, out, frame_size, shift);
+}
+
+// Interpolation by 2: each call consumes 16 input samples and produces 2 * 16 outputs
+using interpolator_t = aie::fir_interpolator<Taps, 2, Lanes, int16, int16>;
+
+void interpolate_int16(interpolator_t &fir, const int16 *in, int16 *out, unsigned frame_size, int shift)
+{
+    fir.run(in, out, frame_size, shift);
+}
+//![Polyphase FIR]
+
+//![Symmetric FIR]
+// Linear-phase lowpass filter. Its coefficients are symmetric, so on AIE they are folded and each coefficient is applied
+// once to the sum of the two samples that share it. Other architectures use aie::fir.
+static constexpr std::array<int16, 15> lowpass_coeffs = {
+    -42, 0, 245, 0, -1078, 0, 4946, 8192, 4946, 0, -1078, 0, 245, 0, -42
+};
+
+using lowpass_t = aie::fir_for<lowpass_coeffs, Lanes, int16>;
+
+void lowpass_int16(lowpass_t &fir, const int16 *in, int16 *out, unsigned frame_size, int shift)
+{
+    fir.run(in, out, frame_size, shift);
+}
+//![Symmetric FIR]
+
+//![Correlator]
+// Searches a stream for a 64-sample preamble. Only the samples whose correlation reaches the threshold are written.
+using correlator_t = aie::correlator<64, 8, cint16, cint16>;
+
+unsigned detect_preamble(correlator_t &corr, const cint16 *in, unsigned frame_size, int32 threshold,
+                         aie::correlator_hit<int32> *hits, unsigned max_hits, int shift)
+{
+    return corr.run(in, frame_size, threshold, hits, max_hits, shift);
+}
+//![Correlator]
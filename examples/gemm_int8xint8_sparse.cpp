@@ -58,3 +58,91 @@ void gemm_int8xint8_sparse(int8 * matA, int8 * matB, int8 *__restrict matC,
     });
 }
 //! [Sparse matrix multiplication]
+
+//! [Sparse weight packing]
+// Packs weights for gemm_int8xint8_sparse. The weights are given as the sequence of 16x8 B tiles in the order in which
+// the kernel consumes them, each tile in row-major order. Sparse multiplications read tiles in column-major order, so
+// each tile is transposed before it is packed.
+//
+// Returns the number of int8 elements written to `packed`, or 0 if the weights do not have two zero values in each
+// group of four consecutive values along the columns of B.
+unsigned pack_weights_int8(const int8 * dense, unsigned tiles, int8 * packed, float &density)
+{
+    unsigned size    = 0;
+    unsigned nonzero = 0;
+
+    for (unsigned t = 0; t < tiles; ++t) {
+        alignas(aie::vector_decl_align) int8 tile[16 * 8];
+
+        for (unsigned k = 0; k < 16; ++k)
+            for (unsigned n = 0; n < 8; ++n)
+                tile[n * 16 + k] = dense[t * 16 * 8 + k * 8 + n];
+
+        const aie::sparse_pack_result res = aie::sparse_pack(tile, 16 * 8, packed + size);
+
+        if (!res.valid)
+            return 0;
+
+        size    += res.size;
+        nonzero += res.nonzero_elems;
+    }
+
+    density = float(nonzero) / (tiles * 16 * 8);
+
+    return size;
+}
+//! [Sparse weight packing]
+
+// Dense counterpart of gemm_int8xint8_sparse, which reads the same weights without compression. Running both kernels
+// on the same weights measures the speedup of sparse multiplications.
+void gemm_int8xint8_dense(int8 * matA, int8 * matB, int8 *__restrict matC,
+                          int rowsA, int inner, int colsB)
+{
+    using MMUL = aie::mmul<4, 16, 8, int8, int8>;
+
+    auto a_desc = aie::make_tensor_descriptor<int8, 64>(aie::tensor_dim(rowsA / 4 / 4, 2),
+                                                        aie::tensor_dim(colsB / 4 / 4, 0),
+                                                        aie::tensor_dim(inner / 8, rowsA / 8),
+                                                        aie::tensor_dim(2u, 1));
+
+    auto c_desc = aie::make_tensor_descriptor<int8, 32>(aie::tensor_dim(rowsA / 4 / 4, 4),
+                                                        aie::tensor_dim(colsB / 8, rowsA / 4),
+                                                        aie::tensor_dim(4u, 1));
+
+    auto tsA = aie::make_tensor_buffer_stream<aie_dm_resource::a>(matA, a_desc);
+    auto tsC = aie::make_restrict_tensor_buffer_stream(matC, c_desc);
+
+    aie::pipelined_loop</*Minimum iterations =*/ 2>(rowsA / 16, [&](unsigned j)  __aie_inline
+    {
+        const int8 * __restrict pB = matB;
+
+        aie::pipelined_loop</*Minimum iterations =*/ 2>(colsB / 16, [&](unsigned b)  __aie_inline
+        {
+            MMUL C00, C01;
+            MMUL C10, C11;
+            MMUL C20, C21;
+            MMUL C30, C31;
+
+            aie::pipelined_loop</*Minimum iterations =*/ 4>(inner / 16, [&](unsigned i)  __aie_inline
+            {
+                aie::vector<int8,64> Sbuff0, Sbuff1, Sbuff2, Sbuff3;
+                tsA.pop() >> Sbuff0 >> Sbuff1;
+                tsA.pop() >> Sbuff2 >> Sbuff3;
+
+                auto [Xbuff0, Xbuff1] = aie::interleave_zip(Sbuff0, Sbuff2, 8);
+                auto [Xbuff2, Xbuff3] = aie::interleave_zip(Sbuff1, Sbuff3, 8);
+
+                aie::vector<int8,128> Ybuff0 = aie::load_v<128>(pB); pB += 128;
+                aie::vector<int8,128> Ybuff1 = aie::load_v<128>(pB); pB += 128;
+
+                C00.mac(Xbuff0, Ybuff0); C01.mac(Xbuff0, Ybuff1);
+                C10.mac(Xbuff1, Ybuff0); C11.mac(Xbuff1, Ybuff1);
+                C20.mac(Xbuff2, Ybuff0); C21.mac(Xbuff2, Ybuff1);
+                C30.mac(Xbuff3, Ybuff0); C31.mac(Xbuff3, Ybuff1);
+            });
+
+            tsC << C00.to_vector<int8>() << C10.to_vector<int8>() << C20.to_vector<int8>() << C30.to_vector<int8>()
+                << C01.to_vector<int8>() << C11.to_vector<int8>() << C21.to_vector<int8>() << C31.to_vector<int8>();
+        });
+    });
+}
@@ -0,0 +1,26 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2022 Xilinx, Inc.
+// Copyright (C) 2022-2026 Advanced Micro Devices, Inc.
+
+#include <aie_api/aie.hpp>
+
+//![Biquad cascade]
+// DC blocker followed by a peaking equaliser. Each call to filter computes a block of 16 outputs with vector operations.
+using equaliser_t = aie::biquad_cascade<2, 16>;
+
+static const std::array<aie::biquad_coeffs, 2> equaliser_coeffs = {{
+    {1.0f,     -1.0f,      0.0f,     -0.995f,    0.0f},
+    {1.0156f,  -1.8634f,   0.8651f,  -1.8634f,   0.8807f}
+}};
+
+equaliser_t make_equaliser()
+{
+    return equaliser_t(equaliser_coeffs);
+}
+
+// The state of each section is kept in the object, so consecutive frames are filtered as a continuous signal
+void equalise(equaliser_t &eq, const int16 *in, int16 *out, unsigned frame_size)
+{
+    eq.run(in, out, frame_size);
+}
+//![Biquad cascade]
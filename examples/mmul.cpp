@@ -51,3 +51,42 @@ void mmul_blocked(unsigned rowA, unsigned colA, unsigned colB,
    }
 }
 //![Blocked matrix multiplication]
+
+//![Tiled GEMM]
+void gemm_int8(const int8 * __restrict pA, const int8 * __restrict pB, int8 * __restrict pC,
+               unsigned rows, unsigned inner, unsigned cols)
+{
+    // Matrices are stored in the tiled layout of aie::default_gemm_config<int8, int8>::mmul_type, and their dimensions
+    // are multiples of the rows_multiple, inner_multiple and cols_multiple members of the same config.
+    aie::gemm<int8, int8, int8>(pA, pB, pC, rows, inner, cols, /* shift */ 8);
+}
+//![Tiled GEMM]
+
+//![GEMM with fused epilogue]
+void dense_relu_int8(const int8 * __restrict pA, const int8 * __restrict pB, int8 * __restrict pC,
+                     const int32 * __restrict bias, const int16 * __restrict scale,
+                     unsigned rows, unsigned inner, unsigned cols)
+{
+    // Per output channel (column) bias and scale, followed by ReLU, applied before each tile of C is stored
+    using epilogue = aie::gemm_requantize_epilogue<int8, int32, int16, aie::gemm_channels::per_col,
+                                                   aie::gemm_relu_activation>;
+
+    aie::gemm<int8, int8, int8>(pA, pB, pC, rows, inner, cols, epilogue(bias, scale, /* shift */ 14));
+}
+//![GEMM with fused epilogue]
+
+//![2D convolution]
+void conv3x3_relu_int8(const int8 * __restrict in, const int8 * __restrict weights, int8 * __restrict out,
+                       const int32 * __restrict bias, const int16 * __restrict scale,
+                       unsigned in_height, unsigned in_width)
+{
+    // 3x3 convolution from 32 to 64 channels. Tensors are stored in blocks of conv::in_block and conv::out_block
+    // channels, so the input tiles of each tap are loaded with a single vector load. The weights were reordered with
+    // conv::pack_weights.
+    using conv     = aie::conv2d<3, 3, 32, 64, int8, int8, aie::conv2d_layout::nchw_blocked>;
+    using epilogue = aie::gemm_requantize_epilogue<int8, int32, int16, aie::gemm_channels::per_col,
+                                                   aie::gemm_relu_activation>;
+
+    conv::run(in, weights, out, in_height, in_width, epilogue(bias, scale, /* shift */ 14));
+}
+//![2D convolution]
@@ -0,0 +1,21 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2022 Xilinx, Inc.
+// Copyright (C) 2022-2026 Advanced Micro Devices, Inc.
+
+#include <aie_api/aie.hpp>
+
+//![Mixer]
+// Shifts a complex baseband signal by -fs / 8. Phases are 32b values in which 2^32 is a full turn.
+using nco_t = aie::nco<8>;
+
+nco_t make_downconverter()
+{
+    return nco_t(-(1u << 29));
+}
+
+// The oscillator keeps its phase, so consecutive frames are mixed as a continuous signal
+void downconvert(nco_t &osc, const cint16 *in, cint16 *out, unsigned frame_size)
+{
+    osc.run(in, out, frame_size);
+}
+//![Mixer]
@@ -0,0 +1,24 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2022 Xilinx, Inc.
+// Copyright (C) 2022-2026 Advanced Micro Devices, Inc.
+
+#include <aie_api/aie.hpp>
+
+//![Transformer normalization]
+// Pre-normalization of a transformer block: each token is normalized with learned scales and offsets. hidden must be a
+// multiple of 32.
+void normalize_tokens(const bfloat16 * __restrict x, const bfloat16 * __restrict gamma,
+                      const bfloat16 * __restrict beta, bfloat16 * __restrict y, unsigned tokens, unsigned hidden)
+{
+    for (unsigned t = 0; t < tokens; ++t)
+        aie::layer_norm<bfloat16, 32>(x + t * hidden, gamma, beta, y + t * hidden, hidden);
+}
+
+// Same as above, for models that use RMS normalization without offsets
+void rms_normalize_tokens(const bfloat16 * __restrict x, const bfloat16 * __restrict gamma, bfloat16 * __restrict y,
+                          unsigned tokens, unsigned hidden)
+{
+    for (unsigned t = 0; t < tokens; ++t)
+        aie::rms_norm<bfloat16, 32>(x + t * hidden, gamma, y + t * hidden, hidden);
+}
+//![Transformer normalization]
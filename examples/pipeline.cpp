@@ -0,0 +1,39 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2022 Xilinx, Inc.
+// Copyright (C) 2022-2026 Advanced Micro Devices, Inc.
+
+#include <aie_api/aie.hpp>
+
+// Doubles a block of samples. size must be a multiple of 32.
+void scale(const int16 * __restrict x, int16 * __restrict y, unsigned size)
+{
+    for (unsigned i = 0; i < size; i += 32) {
+        aie::vector<int16, 32> v = aie::load_v<32>(x + i);
+
+        aie::store_v(y + i, aie::add(v, v));
+    }
+}
+
+// The semaphores of AIE-ML and later hold the read and write locks of all the buffers of a rotation
+#if __AIE_ARCH__ >= 20
+//![Pipeline]
+// Reads ping-pong input blocks and sends the output blocks to two consumer kernels, which use one pair of locks each.
+// The input and output transfers of one block overlap with the processing of the other.
+void scale_stream(int16 *in_ping, int16 *in_pong, int16 *out_ping, int16 *out_pong,
+                  unsigned in_read_lock, unsigned in_write_lock,
+                  unsigned out_read_lock0, unsigned out_write_lock0,
+                  unsigned out_read_lock1, unsigned out_write_lock1,
+                  unsigned size, unsigned iterations)
+{
+    aie::sync::consumer_sem<1, 1> in_sem(in_read_lock, in_write_lock);
+    aie::sync::producer_sem<2, 1> out_sem({out_read_lock0, out_read_lock1}, {out_write_lock0, out_write_lock1});
+
+    aie::sync::buffered_input<int16 *, 2>        in(in_ping, in_pong, in_sem, size);
+    aie::sync::buffered_output<int16 *, 2, 2, 1> out(out_ping, out_pong, out_sem, size);
+
+    aie::pipeline p(in, out);
+
+    p.run(iterations, [&](const int16 *x, int16 *y) { scale(x, y, size); });
+}
+//![Pipeline]
+#endif
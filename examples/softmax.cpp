@@ -0,0 +1,16 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2022 Xilinx, Inc.
+// Copyright (C) 2022-2026 Advanced Micro Devices, Inc.
+
+#include <aie_api/aie.hpp>
+
+//![Attention softmax]
+// Normalizes each row of a matrix of attention scores. Rows do not need to be a multiple of the vector size, but each
+// of them must start at an aligned address.
+void attention_softmax(const bfloat16 * __restrict scores, bfloat16 * __restrict probs,
+                       unsigned queries, unsigned keys, unsigned row_stride)
+{
+    for (unsigned q = 0; q < queries; ++q)
+        aie::softmax<bfloat16, 32>(scores + q * row_stride, probs + q * row_stride, keys);
+}
+//![Attention softmax]
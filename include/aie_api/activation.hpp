@@ -0,0 +1,418 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2022 Xilinx, Inc.
+// Copyright (C) 2022-2026 Advanced Micro Devices, Inc.
+
+/**
+ * @file
+ * @brief Activation functions evaluated with lookup tables that are generated at compile time.
+ */
+
+#pragma once
+
+#ifndef __AIE_API_ACTIVATION__HPP__
+#define __AIE_API_ACTIVATION__HPP__
+
+#include "lut_builder.hpp"
+
+namespace aie::activation {
+
+/**
+ * @ingroup group_lut
+ *
+ * Functions computed by @ref approximation.
+ */
+enum class kind
+{
+    gelu,    /**< x * Phi(x), where Phi is the cumulative distribution function of the standard normal distribution */
+    silu,    /**< x * sigmoid(x) */
+    sigmoid, /**< 1 / (1 + exp(-x)) */
+    erf      /**< Error function */
+};
+
+} // namespace aie::activation
+
+namespace aie::detail {
+
+// Default number of fractional bits of integer values, which leaves the given number of integer bits, sign included
+template <typename T>
+static constexpr unsigned activation_frac(unsigned int_bits)
+{
+    return is_floating_point_v<T>? 0 : type_bits_v<T> - int_bits;
+}
+
+// Each function provides:
+//  - eval: the function, evaluated at compile time.
+//  - below, above: the {slope, offset} of the lines used below and above the domain of the bfloat16 tables.
+//  - range, segment_bits: the bfloat16 tables cover [-range, range) with segments of 2^-segment_bits.
+//  - in_int_bits, out_int_bits: integer bits of the default fixed-point formats.
+template <activation::kind Fn>
+struct activation_traits;
+
+template <>
+struct activation_traits<activation::kind::gelu>
+{
+    static constexpr double eval(double x)
+    {
+        return 0.5 * x * (1.0 + constexpr_math::erf(x * 0.70710678118654752440));
+    }
+
+    static constexpr std::pair<double, double> below = {0.0, 0.0};
+    static constexpr std::pair<double, double> above = {1.0, 0.0};
+
+    static constexpr unsigned range        = 8;
+    static constexpr unsigned segment_bits = 3;
+    static constexpr unsigned in_int_bits  = 4;
+    static constexpr unsigned out_int_bits = 4;
+};
+
+template <>
+struct activation_traits<activation::kind::silu>
+{
+    static constexpr double eval(double x)
+    {
+        return x / (1.0 + constexpr_math::exp(-x));
+    }
+
+    // silu approaches zero slowly for negative values, so its domain is wider
+    static constexpr std::pair<double, double> below = {0.0, 0.0};
+    static constexpr std::pair<double, double> above = {1.0, 0.0};
+
+    static constexpr unsigned range        = 16;
+    static constexpr unsigned segment_bits = 3;
+    static constexpr unsigned in_int_bits  = 4;
+    static constexpr unsigned out_int_bits = 4;
+};
+
+template <>
+struct activation_traits<activation::kind::sigmoid>
+{
+    static constexpr double eval(double x)
+    {
+        return 1.0 / (1.0 + constexpr_math::exp(-x));
+    }
+
+    static constexpr std::pair<double, double> below = {0.0, 0.0};
+    static constexpr std::pair<double, double> above = {0.0, 1.0};
+
+    static constexpr unsigned range        = 8;
+    static constexpr unsigned segment_bits = 3;
+    static constexpr unsigned in_int_bits  = 4;
+    static constexpr unsigned out_int_bits = 1;
+};
+
+template <>
+struct activation_traits<activation::kind::erf>
+{
+    static constexpr double eval(double x)
+    {
+        return constexpr_math::erf(x);
+    }
+
+    static constexpr std::pair<double, double> below = {0.0, -1.0};
+    static constexpr std::pair<double, double> above = {0.0,  1.0};
+
+    static constexpr unsigned range        = 4;
+    static constexpr unsigned segment_bits = 4;
+    static constexpr unsigned in_int_bits  = 3;
+    static constexpr unsigned out_int_bits = 1;
+};
+
+// Direct lookup table for int8 inputs, with one entry per input
+template <activation::kind Fn, unsigned InFrac, unsigned OutFrac>
+constexpr lut_table<4, 256, int8> activation_int8_table()
+{
+    const double range = 128.0 / double(1u << InFrac);
+
+    return make_lut<4, 256, int8>(activation_traits<Fn>::eval, {-range, range}, 0, double(1u << OutFrac));
+}
+
+// Fractional bits added to the slopes and offsets of the int16 tables
+static constexpr unsigned activation_int16_shift = 15;
+
+// Linear approximation table for int16 inputs. Entry i covers the inputs whose upper byte is i - 128, and the slope is
+// applied to the lower byte. The accumulated values have OutFrac + activation_int16_shift fractional bits, and they are
+// kept within the range of int16 after the shift.
+template <activation::kind Fn, unsigned InFrac, unsigned OutFrac>
+constexpr lut_table<4, 256, int32, int32> activation_int16_table()
+{
+    constexpr double scale = double(uint64_t(1) << activation_int16_shift);
+    constexpr double hi    = 32767.0 * scale;
+    constexpr double lo    = -32768.0 * scale;
+
+    const double range = 32768.0 / double(1u << InFrac);
+
+    auto f = [](double x) {
+        return std::max(std::min(activation_traits<Fn>::eval(x) * double(1u << OutFrac), 32767.0), -32768.0);
+    };
+
+    lut_table<4, 256, int32, int32> ret = make_lut<4, 256, int32, int32>(f, {-range, range}, 8, scale);
+
+    // The approximation must not leave the range of int16 at either end of the entry
+    for (unsigned i = 0; i < 256; ++i) {
+        auto [slope, offset] = ret.get(i);
+
+        const double end = offset + slope * 255.0;
+
+        offset -= std::max(std::max(offset, end) - hi, 0.0);
+        offset += std::max(lo - std::min(offset, end), 0.0);
+
+        ret.set(i, slope, offset);
+    }
+
+    return ret;
+}
+
+// Linear approximation table for bfloat16 inputs. The inputs are scaled by 2^segment_bits, so that entry i covers the
+// scaled inputs in [i - elems / 2, i - elems / 2 + 1). The first and last entries hold the lines used outside of the
+// domain.
+template <activation::kind Fn>
+constexpr lut_table<4, 2 * activation_traits<Fn>::range << activation_traits<Fn>::segment_bits, float, bfloat16>
+activation_bfloat16_table()
+{
+    using traits = activation_traits<Fn>;
+
+    constexpr unsigned elems = 2 * traits::range << traits::segment_bits;
+    constexpr double   step  = 1.0 / double(1u << traits::segment_bits);
+
+    auto ret = make_lut<4, elems, float, bfloat16>(traits::eval, {-double(traits::range), double(traits::range)});
+
+    ret.set(0,         traits::below.first * step, traits::below.second);
+    ret.set(elems - 1, traits::above.first * step, traits::above.second);
+
+    return ret;
+}
+
+template <activation::kind Fn, typename T, unsigned InFrac, unsigned OutFrac>
+struct activation_impl;
+
+// Every int8 input has its own entry, so the results are correctly rounded
+template <activation::kind Fn, unsigned InFrac, unsigned OutFrac>
+struct activation_impl<Fn, int8, InFrac, OutFrac>
+{
+    using lut_type = aie::lut<4, int8>;
+
+    static constexpr unsigned lanes = 32;
+    static constexpr unsigned elems = 256;
+
+    static constexpr lut_table<4, elems, int8> table_ab = activation_int8_table<Fn, InFrac, OutFrac>();
+    static constexpr lut_table<4, elems, int8> table_cd = table_ab;
+
+    activation_impl() :
+        lut_(elems, table_ab.data(), table_cd.data()),
+        lookup_(lut_, 0, table_ab.bias())
+    {
+    }
+
+    __aie_inline
+    vector<int8, lanes> compute(const vector<int8, lanes> &v)
+    {
+        return lookup_.fetch(v);
+    }
+
+    lut_type                             lut_;
+    aie::parallel_lookup<int8, lut_type> lookup_;
+};
+
+template <activation::kind Fn, unsigned InFrac, unsigned OutFrac>
+struct activation_impl<Fn, int16, InFrac, OutFrac>
+{
+    using lut_type = aie::lut<4, int32>;
+
+    static constexpr unsigned lanes     = 16;
+    static constexpr unsigned elems     = 256;
+    static constexpr unsigned step_bits = 8;
+
+    static constexpr lut_table<4, elems, int32, int32> table_ab = activation_int16_table<Fn, InFrac, OutFrac>();
+    static constexpr lut_table<4, elems, int32, int32> table_cd = table_ab;
+
+    activation_impl() :
+        lut_(elems, table_ab.data(), table_cd.data()),
+        approx_(lut_, step_bits, table_ab.bias())
+    {
+    }
+
+    __aie_inline
+    vector<int16, lanes> compute(const vector<int16, lanes> &v)
+    {
+        return approx_.compute(v).template to_vector<int16>(activation_int16_shift);
+    }
+
+    lut_type                            lut_;
+    aie::linear_approx<int16, lut_type> approx_;
+};
+
+// bfloat16 is only available from AIE-ML
+#if AIE_API_ML_VERSION >= 200
+
+template <activation::kind Fn, unsigned InFrac, unsigned OutFrac>
+struct activation_impl<Fn, bfloat16, InFrac, OutFrac>
+{
+    using traits   = activation_traits<Fn>;
+    using lut_type = aie::lut<4, float, bfloat16>;
+
+    static constexpr unsigned lanes = 16;
+    static constexpr unsigned elems = 2 * traits::range << traits::segment_bits;
+
+    static constexpr lut_table<4, elems, float, bfloat16> table_ab = activation_bfloat16_table<Fn>();
+    static constexpr lut_table<4, elems, float, bfloat16> table_cd = table_ab;
+
+    activation_impl() :
+        lut_(elems, table_ab.data(), table_cd.data()),
+        approx_(lut_, 0, table_ab.bias()),
+        scale_(float(1u << traits::segment_bits))
+    {
+    }
+
+    __aie_inline
+    vector<bfloat16, lanes> compute(const vector<bfloat16, lanes> &v)
+    {
+        // The scale is a power of two, so the scaled inputs are exact
+        const vector<bfloat16, lanes> y = mul(v, scale_).template to_vector<bfloat16>();
+
+        return approx_.compute(y).template to_vector<bfloat16>();
+    }
+
+    lut_type                               lut_;
+    aie::linear_approx<bfloat16, lut_type> approx_;
+    bfloat16                               scale_;
+};
+
+#endif // AIE_API_ML_VERSION
+
+} // namespace aie::detail
+
+namespace aie::activation {
+
+/**
+ * @ingroup group_lut
+ *
+ * Evaluates an activation function with a lookup table that is generated at compile time.
+ *
+ * The table depends on the type of the values:
+ *
+ * - int8: a direct @ref aie::parallel_lookup with one entry per input value, so the results are correctly rounded.
+ * - int16: an @ref aie::linear_approx with 256 entries indexed by the upper byte of the input. The slopes and offsets
+ *   are stored as int32 with 15 additional fractional bits, and the outputs are rounded with the current rounding mode.
+ * - bfloat16: an @ref aie::linear_approx over a fixed domain, with segments of 1/8 (1/16 for erf). The inputs are
+ *   scaled by a power of two before the lookup, which is exact. Outside of the domain the function is continued with
+ *   its asymptote (0 or 1 for sigmoid, -1 or 1 for erf, 0 or x for gelu and silu).
+ *
+ * Integer values are fixed-point numbers with InFrac and OutFrac fractional bits. The default formats and the maximum
+ * errors of each function are given below. The errors of the integer types are measured before the outputs are
+ * rounded, in units of the last place of the output format, and the errors of bfloat16 include the rounding of the
+ * outputs.
+ *
+ * <table>
+ * <caption>Default formats and maximum errors</caption>
+ * <tr><th>Function<th>int8 input, output<th>int16 input, output<th>int16 error<th>bfloat16 domain<th>bfloat16 error
+ * <tr><td>gelu   <td>Q3.4, Q3.4 <td>Q3.12, Q3.12<td>0.80 <td>[-8, 8)  <td>2.2e-3 below 1, 0.51 ulp above
+ * <tr><td>silu   <td>Q3.4, Q3.4 <td>Q3.12, Q3.12<td>0.51 <td>[-16, 16)<td>2.2e-3 below 1, 0.51 ulp above
+ * <tr><td>sigmoid<td>Q3.4, Q0.7 <td>Q3.12, Q0.15<td>0.77 <td>[-8, 8)  <td>2.1e-3
+ * <tr><td>erf    <td>Q2.5, Q0.7 <td>Q2.13, Q0.15<td>1.94 <td>[-4, 4)  <td>2.2e-3
+ * </table>
+ *
+ * int8 results are within 0.5 units of the last place. The tables take 2 KiB (int8), 8 KiB (int16) and 4 KiB
+ * (bfloat16, 8 KiB for silu) of memory, as two copies for four parallel accesses, which must be placed in different
+ * memory banks to achieve four lookups per cycle. The errors of bfloat16 assume the default aie::rounding_mode::floor,
+ * which is used to select the entry of the table. On AIE, only int8 and int16 are available, with the same tables and
+ * results, and the lookups are done at up to two per cycle.
+ *
+ * @code
+ * aie::activation::gelu<bfloat16> gelu;
+ *
+ * gelu.run(in, out, n);
+ * @endcode
+ *
+ * @tparam Fn      Function to compute.
+ * @tparam T       Type of the input and output values. Must be int8, int16 or bfloat16 (not available on AIE).
+ * @tparam InFrac  Fractional bits of the inputs. Must be 0 for bfloat16.
+ * @tparam OutFrac Fractional bits of the outputs. Must be 0 for bfloat16.
+ */
+template <kind Fn, ElemBaseType T,
+          unsigned InFrac  = detail::activation_frac<T>(detail::activation_traits<Fn>::in_int_bits),
+          unsigned OutFrac = detail::activation_frac<T>(detail::activation_traits<Fn>::out_int_bits)>
+    requires((arch::is(arch::Gen1, arch::Gen2) && (std::is_same_v<T, int8> || std::is_same_v<T, int16>) &&
+              InFrac < detail::type_bits_v<T> && OutFrac < detail::type_bits_v<T>) ||
+             (arch::is(arch::Gen2) && std::is_same_v<T, bfloat16> && InFrac == 0 && OutFrac == 0))
+class approximation
+{
+    using impl_type = detail::activation_impl<Fn, T, InFrac, OutFrac>;
+
+public:
+    /** Number of values computed in each call to compute */
+    static constexpr unsigned lanes = impl_type::lanes;
+
+    /**
+     * Evaluates the function on a vector of values.
+     *
+     * @param v Input values.
+     */
+    __aie_inline
+    vector<T, lanes> compute(const vector<T, lanes> &v)
+    {
+        return impl_.compute(v);
+    }
+
+    /**
+     * Evaluates the function on an array of values.
+     *
+     * @param in  Input values. It must be aligned to vector_decl_align.
+     * @param out Output values. It must be aligned to vector_decl_align.
+     * @param n   Number of values. It must be a multiple of lanes.
+     */
+    void run(const T * __restrict in, T * __restrict out, unsigned n)
+    {
+        for (unsigned i = 0; i < n / lanes; ++i)
+            chess_prepare_for_pipelining
+        {
+            store_v(out + i * lanes, compute(load_v<lanes>(in + i * lanes)));
+        }
+    }
+
+private:
+    impl_type impl_;
+};
+
+/**
+ * @ingroup group_lut
+ *
+ * Gaussian error linear unit: x * Phi(x). See @ref approximation.
+ */
+template <ElemBaseType T,
+          unsigned InFrac  = detail::activation_frac<T>(detail::activation_traits<kind::gelu>::in_int_bits),
+          unsigned OutFrac = detail::activation_frac<T>(detail::activation_traits<kind::gelu>::out_int_bits)>
+using gelu = approximation<kind::gelu, T, InFrac, OutFrac>;
+
+/**
+ * @ingroup group_lut
+ *
+ * Sigmoid linear unit: x * sigmoid(x). See @ref approximation.
+ */
+template <ElemBaseType T,
+          unsigned InFrac  = detail::activation_frac<T>(detail::activation_traits<kind::silu>::in_int_bits),
+          unsigned OutFrac = detail::activation_frac<T>(detail::activation_traits<kind::silu>::out_int_bits)>
+using silu = approximation<kind::silu, T, InFrac, OutFrac>;
+
+/**
+ * @ingroup group_lut
+ *
+ * Logistic function: 1 / (1 + exp(-x)). See @ref approximation.
+ */
+template <ElemBaseType T,
+          unsigned InFrac  = detail::activation_frac<T>(detail::activation_traits<kind::sigmoid>::in_int_bits),
+          unsigned OutFrac = detail::activation_frac<T>(detail::activation_traits<kind::sigmoid>::out_int_bits)>
+using sigmoid = approximation<kind::sigmoid, T, InFrac, OutFrac>;
+
+/**
+ * @ingroup group_lut
+ *
+ * Error function. See @ref approximation.
+ */
+template <ElemBaseType T,
+          unsigned InFrac  = detail::activation_frac<T>(detail::activation_traits<kind::erf>::in_int_bits),
+          unsigned OutFrac = detail::activation_frac<T>(detail::activation_traits<kind::erf>::out_int_bits)>
+using erf = approximation<kind::erf, T, InFrac, OutFrac>;
+
+} // namespace aie::activation
+
+#endif
@@ -49,6 +49,8 @@
 #include "detail/conj.hpp"
 #include "detail/elementary.hpp"
 #include "detail/fft.hpp"
+#include "detail/fft_plan.hpp"
+#include "detail/gemm.hpp"
 #include "detail/filter.hpp"
 #include "detail/interleave.hpp"
 #include "detail/ld_st.hpp"
@@ -77,7 +79,9 @@
 #include "fft.hpp"
 #include "iterator.hpp"
 #include "mask.hpp"
+#include "pipeline.hpp"
 #include "sliding_mul.hpp"
+#include "sparse_pack.hpp"
 #include "sparse_vector.hpp"
 #include "tile.hpp"
 #include "types.hpp"
@@ -6705,14 +6709,27 @@ auto mmac_fn(Acc &c, const VecA &a, const VecB &b)
     return c;
 }
 
-//TODO: Document
+/**
+ * @ingroup group_mul_special
+ *
+ * Building blocks for peak cancellation crest factor reduction (CFR) of cint16 signals. find_peak returns the sample
+ * with the largest squared magnitude of a vector, computed with abs_square and a max reduction. The stage iterator
+ * returned by begin reads, at each step, the two blocks of the cancellation pulse selected by a control word, and mul
+ * and mac scale the selected window of the pulse by a peak value. On AIE the stages use the dedicated CFR
+ * multiplications, and on AIE-ML and later they are emulated with vector shuffles and multiplications, which support
+ * pulse selections (the 5 LSBs of the control words) up to 15.
+ *
+ * The squared magnitudes computed by find_peak are int32 values. With a shift of 0, the squared magnitude of
+ * -32768-32768j (2^31) does not fit: it saturates to 2^31 - 1 when saturation is enabled, and wraps otherwise. A shift
+ * of 1 avoids the overflow at the cost of one bit of precision.
+ */
 template <typename T>
 using cfr = detail::cfr<T>;
 
 using detail::lut_oor_policy;
 
 template <unsigned ParallelAccesses, typename OffsetType, typename SlopeType>
-    requires (arch::is(arch::Gen2))
+    requires (arch::is(arch::Gen1, arch::Gen2))
 struct lut;
 
 template <typename T>
@@ -6751,7 +6768,9 @@ concept ParallelLUT = is_lut_v<T>;
  *   For example with 32b values and a 128b bank width, in memory we would have the first 4 values (128b), then the same 4 again, then the next 4, which then repeat, etc.
  * - For 4 loads in parallel, we require the same layout as for 2 loads, but two distinct copies in this layout, placed in different memory banks.
  *
- * Currently the only supported implementation on this architecture is for 4 parallel accesses.
+ * On AIE-ML and later, the only supported implementation is for 4 parallel accesses. On AIE, lookups are done with
+ * scalar loads that alternate between the copies of the data, which achieves up to 2 lookups per cycle, and tables for
+ * 1, 2 and 4 parallel accesses are supported.
  *
  * @tparam ParallelAccesses Defines how many parallel accesses will be done in a single LUT access, possibilities depend on the hardware available for the given architecture
  * @tparam OffsetType Type of values stored within the lookup table.
@@ -6759,7 +6778,7 @@ concept ParallelLUT = is_lut_v<T>;
  *
  */
 template <unsigned ParallelAccesses, typename OffsetType, typename SlopeType=OffsetType>
-    requires (arch::is(arch::Gen2))
+    requires (arch::is(arch::Gen1, arch::Gen2))
 struct lut : public detail::lut<ParallelAccesses, OffsetType, SlopeType>
 {
     using offset_type = OffsetType;
@@ -6844,7 +6863,8 @@ struct lut : public detail::lut<ParallelAccesses, OffsetType, SlopeType>
  * @ingroup group_lut
  *
  * \note
- * Linear approximation functionality is only available from AIE-ML/XDNA1
+ * On AIE, only integer linear approximations are available. The slope/offset pairs are gathered with scalar loads and
+ * the interpolation is computed with a single vector multiplication, see the table below.
  *
  * Type to support a linear approximation via interpolation with slope/offset values stored in a lookup table.
  *
@@ -6892,6 +6912,14 @@ struct lut : public detail::lut<ParallelAccesses, OffsetType, SlopeType>
  * <tr><td>%bfloat16<td>%float<td>%bfloat16 <td>%accfloat <td>16 <td> 0
  * </table>
  *
+ * <table>
+ * <caption>Supported linear approximation types on AIE</caption>
+ * <tr><th>Input<th>Offset<th>Slope<th>Accumulator type<th>Lanes
+ * <tr><td>%int8, %int16<td>%int8 <td>%int8 <td>%acc48 <td>8, 16
+ * <tr><td>%int8, %int16<td>%int16 <td>%int16 <td>%acc48 <td>8, 16
+ * <tr><td>%int8, %int16<td>%int32 <td>%int32 <td>%acc80 <td>8, 16
+ * </table>
+ *
  * Note that while the floating point linear approx requires the offset data to be 32b floats, the slope data is required to be bfloat16.
  * However, it is required that all values in the LUT be 32b to ensure the LUT is correctly aligned.
  * While it is safe to use floats as the storage type for the lookup table, it is required that the low 16 mantissa bits of the floating
@@ -6901,7 +6929,7 @@ struct lut : public detail::lut<ParallelAccesses, OffsetType, SlopeType>
  * @tparam MyLUT Definition of the LUT type, using the @ref lut type.
  */
 template <typename T, ParallelLUT MyLUT>
-    requires (arch::is(arch::Gen2))
+    requires (arch::is(arch::Gen1, arch::Gen2))
 struct linear_approx
 {
     /**
@@ -6938,7 +6966,8 @@ private:
  * @ingroup group_lut
  *
  * \note
- * Parallel lookup functionality is only available from AIE-ML/XDNA1
+ * On AIE, lookups are done with scalar loads, and achieve up to 2 lookups per cycle with tables for 2 or 4 parallel
+ * accesses.
  *
  * Type with functionality to directly index a LUT based on input vector of values.
  * The number of achieved lookups per cycle is determined by the \ref aie::lut object that encapsulates the contents of the lookup table.
@@ -6953,7 +6982,7 @@ private:
  * @tparam oor_policy Defines the "out of range policy" for when index values on the input go beyond the size of the LUT. It can either saturate, taking on the min/max valid index, or truncate, retaining the lower bits for unsigned indicies or wrapping in the interval [-bias,lut_size-bias) for signed indices. Saturating is the default behaviour, but for certain non-linear functions which repeat after an interval truncation may be required.
  */
 template <typename T, ParallelLUT MyLUT, lut_oor_policy oor_policy = lut_oor_policy::saturate>
-    requires (arch::is(arch::Gen2))
+    requires (arch::is(arch::Gen1, arch::Gen2))
 struct parallel_lookup
 {
     /**
@@ -8252,6 +8281,20 @@ BINARY_OP_IMPL(Neg)
 #endif
 #include "operators.hpp"
 
+// Algorithms built on top of the operations defined above
+#include "activation.hpp"
+#include "channelizer.hpp"
+#include "conv2d.hpp"
+#include "fft_window.hpp"
+#include "fir.hpp"
+#include "gemm.hpp"
+#include "iir.hpp"
+#include "lut_builder.hpp"
+#include "nco.hpp"
+#include "normalization.hpp"
+#include "rfft.hpp"
+#include "softmax.hpp"
+
 #endif
 
 #endif
@@ -936,6 +936,13 @@
  * }
  * @endcode
  *
+ * Dense data can be converted to this layout with @ref aie::sparse_pack, which also checks the sparsity constraint and
+ * reports the density of the data. It is a constexpr function that does not rely on AIE intrinsics, so it can be used
+ * to pack constant weights at compile time or on the host. The following example packs the weights of a sparse matrix
+ * multiplication, whose tiles are read in column-major order:
+ *
+ * @snippet gemm_int8xint8_sparse.cpp Sparse weight packing
+ *
  * For a more comprehensive sparse matrix multiplication example, see \ref group_mmul_page_supported_sparse_modes.
  *
  *
@@ -982,6 +989,20 @@
  *
  */
 
+/**
+ * @defgroup group_pipeline Pipelines
+ *
+ * Kernels that exchange data with other kernels or with DMAs through several buffers synchronize each access with
+ * locks. @ref aie::pipeline runs a kernel over a set of synchronized buffers (aie::sync::buffered_input and
+ * aie::sync::buffered_output): each step acquires the current buffer of every input and output, calls the kernel with
+ * them, and releases them so that the next step works on the next buffer of each rotation. With two or more buffers,
+ * the transfers of one buffer overlap with the processing of another.
+ *
+ * The following example, for AIE-ML, processes ping-pong input buffers and sends its output to two consumer kernels:
+ *
+ * @snippet pipeline.cpp Pipeline
+ */
+
 /**
  * @defgroup group_init Initialization
  *
@@ -1152,6 +1173,23 @@
 
 /**
  * @defgroup group_elementary Elementary Functions
+ *
+ * @section elementary_softmax Softmax
+ *
+ * @ref aie::softmax and @ref aie::log_softmax normalize a row of values in two passes. The first pass computes the
+ * maximum and the sum of the exponentials together (online softmax). The second pass writes the outputs. The
+ * exponentials use @ref aie::exp2 and the sums are accumulated in accfloat. Rows of any length are supported.
+ *
+ * @snippet softmax.cpp Attention softmax
+ *
+ * @section elementary_normalization Normalization
+ *
+ * @ref aie::layer_norm and @ref aie::rms_norm normalize a row of values and apply per-element scales (and offsets for
+ * layer normalization). The statistics of the row are computed in a single pass, and the normalization and the affine
+ * transform are applied together in a second pass, with one multiply-accumulate per value. The length of the row must
+ * be a multiple of the vector size.
+ *
+ * @snippet normalization.cpp Transformer normalization
  */
 
 /**
@@ -1218,6 +1256,34 @@
  *    b30, b31, b32, b33  // tile B1
  * };
  * @endcode
+ *
+ * @section mmul_gemm Tiled matrix multiplication driver
+ *
+ * @ref aie::gemm implements the loop nest of the blocked multiplication above for matrices of any size. The output
+ * matrix is computed in blocks of several tiles whose accumulators stay in registers while the inner dimension is
+ * traversed. The size of the blocks is derived from the accumulator registers available on the target architecture,
+ * and is described by @ref aie::gemm_config. When the tile shape is not given, @ref aie::default_gemm_config selects
+ * a shape with native support for the input types.
+ *
+ * @snippet mmul.cpp Tiled GEMM
+ *
+ * Each output tile is passed to an epilogue before it is stored. The epilogue receives the tile while it is still in
+ * the accumulator registers, so operations such as the addition of a bias, requantization and activation functions do
+ * not need additional passes over the output matrix. @ref aie::gemm_requantize_epilogue implements the common
+ * bias, scale and activation sequence of quantized layers, and user-defined callables can be used for other cases.
+ *
+ * @snippet mmul.cpp GEMM with fused epilogue
+ *
+ * @section mmul_conv2d 2D convolutions
+ *
+ * @ref aie::conv2d computes 2D convolutions with the same blocking and epilogues as @ref aie::gemm, treating the
+ * convolution as a multiplication by the im2col expansion of the input. The expansion is never materialized: the A
+ * tiles of each tap of the filters are loaded directly from the input tensor, which avoids writing and reading back a
+ * buffer that is KH x KW times larger than the input. Both NHWC tensors and tensors whose channels are split in blocks
+ * of the tile size are supported, with any stride and dilation. In the blocked layout, the tiles of stride-1 and
+ * stride-2 convolutions are read with one vector load each.
+ *
+ * @snippet mmul.cpp 2D convolution
  */
 
 /**
@@ -1241,6 +1307,101 @@
  * \ref aie::fft_dit_r2_stage, \ref aie::fft_dit_r3_stage, \ref aie::fft_dit_r4_stage, \ref aie::fft_dit_r5_stage
  *
  *
+ * @section planned_fft Whole-transform FFT plans
+ *
+ * \ref aie::fft_plan chooses the sequence of stages for a given point size at compile time, using the fewest stages
+ * (and thus passes over the data) that the current architecture implements for the given types. The twiddle tables
+ * for all the stages are also generated at compile time, so the 512 point FFT above becomes:
+ *
+ * @snippet fft.cpp FFT plan
+ *
+ * The selected radices and vectorizations can be queried with \ref aie::fft_plan::radix and
+ * \ref aie::fft_plan::vectorization, and the generated twiddle tables with \ref aie::fft_plan::twiddles.
+ *
+ * @subsection block_floating_point_fft Block floating point FFTs
+ *
+ * With fixed shifts, the scaling of each stage has to be chosen for the worst case, which loses precision on quiet
+ * signals. \ref aie::fft_plan::run_block_floating_point chooses the shift of each stage from the headroom measured on
+ * the outputs of the previous stage, and returns the total shift as the block exponent of the result. This keeps cint16
+ * storage end to end:
+ *
+ * @snippet fft.cpp Block floating point FFT
+ *
+ * @subsection mixed_radix_fft Mixed-radix FFTs
+ *
+ * Radix 3 and radix 5 stages can be combined with radix 2 and radix 4 stages to compute point sizes that are not a power
+ * of two, such as the 12 * 2^k and 15 * 2^k point transforms used by LTE/NR numerologies. Odd-radix stages require a
+ * vectorization of at least the underlying output vector size (see \ref group_fft_page_supported_modes), but they can be
+ * placed at any position of the stage chain. Running them first always satisfies this requirement, and this is what
+ * \ref aie::fft_plan does:
+ *
+ * @snippet fft.cpp Mixed-radix FFT
+ *
+ * The twiddle tables of odd-radix stages follow the same layout as for any other stage (see \ref twiddle_generation).
+ * For example, the radix 3 stage of a 1536 point transform uses vectorization 512, so `n_stage = 3` and its two tables
+ * contain a single twiddle each; if it was placed second, after a radix 2 stage, it would use vectorization 256,
+ * `n_stage = 6` and tables of 2 twiddles.
+ *
+ * @subsection real_fft Real-input FFTs
+ *
+ * \ref aie::rfft_plan computes the spectrum of N real samples with an N / 2 point complex transform: the samples are
+ * reinterpreted as complex values (no copy is made) and a vectorized split pass produces bins 0 to N / 2 - 1. The
+ * Nyquist bin, which is real like the DC bin, is returned in the imaginary part of bin 0. \ref aie::irfft_plan
+ * computes the inverse transform from the same layout.
+ *
+ * @snippet fft.cpp Real FFT
+ *
+ *
+ * @section batched_fft Batched FFTs
+ *
+ * Multiple independent transforms of the same size can be computed with the `fft_dit_r*_stage_batched` functions, when
+ * their samples are interleaved (sample `i` of transform `b` stored at position `i * Batch + b`). A batched stage is
+ * computed as a single stage with `Batch` times the vectorization, so butterflies that share twiddle factors are
+ * computed back to back for all the transforms, and the twiddle tables are the same as for a single transform.
+ * For example, 16 interleaved 256 point transforms:
+ *
+ * @code
+ * aie::fft_dit_r4_stage_batched<64, 16>(x,   tw1,  tw2,   tw1_2,    256, shift_tw, shift, inv, tmp);
+ * aie::fft_dit_r4_stage_batched<16, 16>(tmp, tw4,  tw8,   tw4_8,    256, shift_tw, shift, inv, y);
+ * aie::fft_dit_r4_stage_batched<4,  16>(y,   tw16, tw32,  tw16_32,  256, shift_tw, shift, inv, tmp);
+ * aie::fft_dit_r4_stage_batched<1,  16>(tmp, tw64, tw128, tw64_128, 256, shift_tw, shift, inv, y);
+ * @endcode
+ *
+ * \note Since the effective vectorization of every stage is multiplied by `Batch`, radix 3 and radix 5 stages become
+ * available at any position of the stage chain once `Vectorization * Batch` reaches the underlying output vector size.
+ *
+ *
+ * @section fused_fft Windowing and output epilogues
+ *
+ * Pre- and post-processing passes can be fused into the first and last stages of a transform, so they do not need
+ * their own loops over tile memory:
+ *
+ * - `aie::fft_dit_r2_stage_windowed` and `aie::fft_dit_r4_stage_windowed` replace the first stage of a transform and
+ *   multiply the input samples by a real window while computing the butterflies.
+ * - The `fft_dit_r*_stage` overloads that take an epilogue apply it to each output vector before it is stored.
+ *   `aie::fft_abs_square_epilogue` stores the squared magnitudes and `aie::fft_block_exponent_epilogue` records the
+ *   headroom of the outputs. Epilogues are currently supported on AIE and AIE-ML.
+ *
+ * For example, the power spectrum of a windowed 1024 point transform on AIE-ML:
+ *
+ * @code
+ * aie::fft_abs_square_epilogue<cint16> power;
+ *
+ * aie::fft_dit_r4_stage_windowed(x, window, 1024, 15, false, tmp);
+ * aie::fft_dit_r4_stage<64>(tmp, tw4,   tw8,   tw4_8,     1024, 15, 0, false, y);
+ * aie::fft_dit_r4_stage<16>(y,   tw16,  tw32,  tw16_32,   1024, 15, 0, false, tmp);
+ * aie::fft_dit_r4_stage<4>(tmp,  tw64,  tw128, tw64_128,  1024, 15, 0, false, y);
+ * aie::fft_dit_r4_stage<1>(y,    tw256, tw512, tw256_512, 1024, 15, 0, false, psd, power);
+ * @endcode
+ *
+ * \ref aie::channelizer uses the same approach to fuse a polyphase filter bank into the first stage of the transform.
+ * The phases of the prototype filter are computed with element-wise multiplications, one lane per phase, and their
+ * accumulated outputs are combined by the butterflies of the first stage, so only the remaining stages of the
+ * transform go through tile memory:
+ *
+ * @snippet channelizer.cpp Channelizer
+ *
+ *
  * @section twiddle_generation Twiddle Generation
  *
  * An R-Radix, N-point FFT requires R-1 twiddle tables per stage.
@@ -1315,13 +1476,68 @@
  *
  * AIE provides hardware support to accelerate special multiplications that can be used to accelerate specific
  * application use cases like (but not limited to) signal processing.
+ *
+ * @section fir_filters FIR filters
+ *
+ * @ref aie::fir implements a streaming FIR filter with any number of taps on top of @ref aie::sliding_mul_ops. It
+ * splits the taps into chunks whose size is chosen for the target architecture, so that only the last chunk contains
+ * zero-padded taps, and keeps the history of the input signal across calls, so that consecutive frames can be filtered
+ * without margins:
+ *
+ * @snippet fir.cpp Streaming FIR
+ *
+ * @ref aie::fir_decimator and @ref aie::fir_interpolator change the sample rate by a power of two. They are implemented
+ * as polyphase filters, whose coefficients are split into phases at compile time, so that only the outputs that are
+ * kept are computed in decimators, and the multiplications by the zeros inserted in the input are skipped in
+ * interpolators:
+ *
+ * @snippet fir.cpp Polyphase FIR
+ *
+ * Filters with symmetric or antisymmetric coefficients, such as linear-phase filters, can be computed with half of the
+ * multiplications on AIE by @ref aie::fir_sym, which applies each coefficient to the sum (or difference) of the two
+ * samples that share it using @ref aie::sliding_mul_sym_ops. Odd numbers of taps are supported, with the centre tap
+ * computed by the same multiplication as the innermost pairs. When the coefficients are known at compile time,
+ * @ref aie::fir_for detects their symmetry and selects @ref aie::fir_sym or @ref aie::fir for the target architecture:
+ *
+ * @snippet fir.cpp Symmetric FIR
+ *
+ * Long filters can be split across a chain of kernels connected by cascade streams with @ref aie::cascade_fir. Each
+ * kernel computes the slice of the taps that corresponds to its position in the chain over a delayed copy of the input,
+ * and the partial results are passed along the chain as @ref aie::partial_sliding_mul values, so the number of taps
+ * computed by each kernel is divided by the number of kernels:
+ *
+ * @snippet cascade_fir.cpp Cascade FIR
+ *
+ * @ref aie::correlator searches a complex signal for a reference sequence. It computes the correlation as a filter with
+ * the conjugated reference and compares the squared magnitudes with a threshold as they are computed, so that only the
+ * detections are written to memory, while the largest correlation is tracked in the same pass:
+ *
+ * @snippet fir.cpp Correlator
+ *
+ * @section iir_filters IIR filters
+ *
+ * @ref aie::biquad_cascade implements a cascade of second-order recursive sections. Instead of computing the recursion
+ * sample by sample, each block of outputs is computed as a FIR filter over the samples of the block, using
+ * @ref aie::sliding_mul_ops, plus the response to the previous block, which is carried across calls in an accumulator:
+ *
+ * @snippet iir.cpp Biquad cascade
+ *
+ * @section nco_mixers Oscillators and mixers
+ *
+ * @ref aie::nco generates a complex exponential of a given frequency and multiplies it with a signal, which shifts the
+ * frequency of the signal. The phase is kept across calls, so consecutive frames are mixed as a continuous signal. On
+ * AIE the rotations are computed with @ref aie::sincos_complex, and on other architectures with a phase recurrence that
+ * takes one vector multiplication per block:
+ *
+ * @snippet nco.cpp Mixer
  */
 
 /**
  * @defgroup group_lut Lookup Tables
  *
  * \note
- * Lookup table functionality is only available from AIE-ML/XDNA1
+ * AIE has no lookup table loads. On AIE, lookups are done with scalar loads that alternate between the copies of the
+ * data, and linear approximations are only available for integer types.
  *
  * Two abstractions are provided to represent lookup tables on AIE architectures:
  *
@@ -1339,6 +1555,22 @@
  * Example implementations of parallel lookup and linear approximation functions are given below:
  *
  * @snippet lookup_table.cpp Example
+ *
+ * @section lut_builder Building tables at compile time
+ *
+ * @ref aie::make_lut samples a function that can be evaluated at compile time, quantizes it to the types of the table
+ * and lays it out for the requested number of parallel accesses, so that new functions do not need tables generated
+ * by scripts. It returns an @ref aie::lut_table, whose contents are aligned and can be passed to @ref aie::lut, and
+ * whose entries can be adjusted with lut_table::set before they are used.
+ *
+ * @section lut_activations Activation functions
+ *
+ * @ref aie::activation::gelu, @ref aie::activation::silu, @ref aie::activation::sigmoid and @ref aie::activation::erf
+ * are ready-made approximations for int8, int16 and bfloat16 values. Their lookup tables are generated at compile time
+ * with @ref aie::make_lut, with the layout required for four parallel accesses. See
+ * @ref aie::activation::approximation for the supported formats and the maximum errors.
+ *
+ * @snippet activation.cpp Activations
  */
 
 /**
@@ -299,10 +299,10 @@ using mutex         = detail::mutex;
 using detail::locked;
 
 template <typename Span, unsigned NumBuffers = 2, unsigned NumReaders = 1, unsigned NumWriters = 1>
-using buffered_input  = detail::sync::input<Span, NumBuffers>;
+using buffered_input  = detail::sync::input<Span, NumBuffers, NumReaders, NumWriters>;
 
 template <typename Span, unsigned NumBuffers = 2, unsigned NumReaders = 1, unsigned NumWriters = 1>
-using buffered_output = detail::sync::output<Span, NumBuffers>;
+using buffered_output = detail::sync::output<Span, NumBuffers, NumReaders, NumWriters>;
 
 }
 
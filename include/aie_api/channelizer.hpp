@@ -0,0 +1,228 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2022 Xilinx, Inc.
+// Copyright (C) 2022-2026 Advanced Micro Devices, Inc.
+
+/**
+ * @file
+ * @brief Polyphase filter bank channelizers, with the filters fused into the first stage of the FFT.
+ */
+
+#pragma once
+
+#ifndef __AIE_API_CHANNELIZER__HPP__
+#define __AIE_API_CHANNELIZER__HPP__
+
+namespace aie {
+
+/**
+ * @ingroup group_fft
+ *
+ * Critically sampled polyphase channelizer, which splits a complex signal into Channels channels of equal bandwidth.
+ *
+ * Each call to step consumes Channels input samples and produces one sample of each channel. Channel c is the output
+ * of the prototype filter h modulated to the centre frequency c * fs / Channels, decimated by Channels:
+ *
+ * @code
+ * y[c][t] = sum(h[n] * x[t * Channels + Channels - 1 - n] * exp(2j * pi * c * n / Channels), n = 0..Taps - 1)
+ * @endcode
+ *
+ * with Taps = Channels * TapsPerPhase. The prototype filter is split into Channels phases of TapsPerPhase taps. The
+ * input samples are commutated to the phases as they are written to the history, so that the phases are computed
+ * together with element-wise multiplications, one lane per phase. The outputs of the phases are combined by an inverse
+ * fft_plan of Channels points.
+ *
+ * The filters are fused into the first stage of the transform, like in fft_dit_r2_stage_windowed and
+ * fft_dit_r4_stage_windowed: the outputs of the phases are kept in the accumulators and combined by the butterflies of
+ * the first stage, so they are neither rounded nor written to memory. Only the remaining stages of the plan are run
+ * from memory.
+ *
+ * @code
+ * using channelizer_t = aie::channelizer<32, 8, cint16>;
+ *
+ * alignas(aie::vector_decl_align) static cint16 tmp[channelizer_t::scratch_size];
+ *
+ * channelizer_t ch(prototype);
+ *
+ * // Consumes frame_size samples and writes frame_size / 32 samples of each of the 32 channels, channel-interleaved
+ * ch.run(in, frame_size, shift, tmp, out);
+ * @endcode
+ *
+ * @tparam Channels     Number of channels, which is also the decimation factor and the size of the transform. The
+ *                      first stage of the fft_plan of that size must be radix 2 or radix 4.
+ * @tparam TapsPerPhase Number of taps of each phase of the prototype filter.
+ * @tparam T            Type of the input samples and of the channel outputs.
+ * @tparam CoeffType    Type of the coefficients of the prototype filter.
+ * @tparam CoeffShift   Decimal point of the coefficients of the prototype filter.
+ */
+template <unsigned Channels, unsigned TapsPerPhase, typename T, typename CoeffType = detail::remove_complex_t<T>,
+          unsigned CoeffShift = 15>
+    requires(detail::is_complex_v<T> && !detail::is_complex_v<CoeffType> && !detail::is_floating_point_v<T> &&
+             is_valid_mul_op_v<T, CoeffType> && TapsPerPhase > 0)
+class channelizer
+{
+    using fft_type = fft_plan<Channels, T>;
+    using plan     = detail::fft_plan<Channels, T, T, typename fft_type::twiddle_type, fft_type::twiddle_shift>;
+
+    static constexpr unsigned first_radix = plan::radices[0];
+    static constexpr unsigned span        = Channels / first_radix;
+    static constexpr unsigned Lanes       = std::min(256 / detail::type_bits_v<T>, span);
+
+    static_assert(first_radix == 2 || first_radix == 4, "The first stage of the transform must be radix 2 or radix 4");
+    static_assert(span % Lanes == 0 && Lanes * detail::type_bits_v<T> >= 128, "Channels is too small");
+
+public:
+    using intermediate_type = typename fft_type::intermediate_type;
+
+    /** Number of channels */
+    static constexpr unsigned channels       = Channels;
+    /** Number of taps of each phase of the prototype filter */
+    static constexpr unsigned taps_per_phase = TapsPerPhase;
+    /** Number of taps of the prototype filter */
+    static constexpr unsigned taps           = Channels * TapsPerPhase;
+    /** Minimum number of elements of type intermediate_type of the scratch buffer given to step and run */
+    static constexpr unsigned scratch_size   = fft_type::scratch_size;
+
+    /**
+     * Creates a channelizer with the given prototype filter and a history of zeros.
+     *
+     * @param coeffs Pointer to the taps coefficients of the prototype filter. It does not need to be aligned.
+     */
+    explicit channelizer(const CoeffType *coeffs)
+    {
+        for (unsigned i = 0; i < taps; ++i)
+            coeffs_[i] = coeffs[i];
+
+        reset();
+    }
+
+    /**
+     * Clears the history of the channelizer, as if all the previous samples were zero.
+     */
+    void reset()
+    {
+        for (unsigned i = 0; i < taps; ++i)
+            history_[i] = T{0, 0};
+
+        pos_ = 0;
+    }
+
+    /**
+     * Consumes Channels input samples and writes one sample of each channel.
+     *
+     * @param in    Input samples. It must be aligned to vector_decl_align.
+     * @param shift Additional shift applied to the outputs of every stage of the transform. The first stage also
+     *              shifts by CoeffShift.
+     * @param tmp   Scratch buffer of at least scratch_size elements. Not accessed if scratch_size is 0.
+     * @param out   Output samples, Channels elements ordered by channel.
+     */
+    __aie_fft_inline
+    void step(const T * __restrict in, unsigned shift, intermediate_type * __restrict tmp, T * __restrict out)
+    {
+        pos_ = pos_ + 1 == TapsPerPhase? 0 : pos_ + 1;
+
+        // Phase p reads the input sample Channels - 1 - p of each block, so blocks are stored reversed
+        T *block = history_ + pos_ * Channels;
+
+        for (unsigned i = 0; i < Channels / Lanes; ++i)
+            store_v(block + i * Lanes, reverse(load_v<Lanes>(in + (Channels / Lanes - 1 - i) * Lanes)));
+
+        if constexpr (plan::num_stages == 1) {
+            first_stage(CoeffShift + shift, out);
+        }
+        else {
+            intermediate_type *dst = plan::template stage_output<0>(tmp, out);
+
+            first_stage(CoeffShift + shift, dst);
+            plan::template run<1>((const intermediate_type *)dst, fft_type::twiddle_shift,
+                                  fft_type::twiddle_shift + shift, true, tmp, out);
+        }
+    }
+
+    /**
+     * Channelizes a block of samples.
+     *
+     * @param in    Input samples. It must be aligned to vector_decl_align.
+     * @param n     Number of input samples. It must be a multiple of Channels.
+     * @param shift Additional shift applied to the outputs of every stage of the transform.
+     * @param tmp   Scratch buffer of at least scratch_size elements. Not accessed if scratch_size is 0.
+     * @param out   Output samples. For each group of Channels input samples, one sample of each channel is written,
+     *              ordered by channel.
+     */
+    void run(const T * __restrict in, unsigned n, unsigned shift, intermediate_type * __restrict tmp, T * __restrict out)
+    {
+        for (unsigned i = 0; i < n / Channels; ++i)
+            step(in + i * Channels, shift, tmp, out + i * Channels);
+    }
+
+private:
+    // Accumulated outputs of Lanes phases starting at the given one
+    __aie_inline
+    auto phases(const T * const *blocks, unsigned p) const
+    {
+        auto acc = mul(load_v<Lanes>(blocks[0] + p), load_v<Lanes>(coeffs_ + p));
+
+        detail::utils::unroll_times<TapsPerPhase - 1>([&](unsigned k) __aie_inline {
+            acc = mac(acc, load_v<Lanes>(blocks[k + 1] + p), load_v<Lanes>(coeffs_ + (k + 1) * Channels + p));
+        });
+
+        return acc;
+    }
+
+    // First stage of the inverse transform, computed on the outputs of the phases. It is equivalent to
+    // fft_dit_r*_stage<span> with first_radix.
+    template <typename U>
+    __aie_inline
+    void first_stage(unsigned shift, U * __restrict out) const
+    {
+        // Tap k of the phases is applied to the block k positions before the newest one
+        const T *blocks[TapsPerPhase];
+
+        for (unsigned k = 0; k < TapsPerPhase; ++k)
+            blocks[k] = history_ + (pos_ >= k? pos_ - k : pos_ + TapsPerPhase - k) * Channels;
+
+        for (unsigned j = 0; j < span / Lanes; ++j)
+            chess_prepare_for_pipelining
+            chess_loop_range(1,)
+        {
+            const unsigned p = j * Lanes;
+
+            if constexpr (first_radix == 2) {
+                const auto y0 = phases(blocks, p);
+                const auto y1 = phases(blocks, p + span);
+
+                store_v(out + p,        add(y0, y1).template to_vector<U>(shift));
+                store_v(out + p + span, sub(y0, y1).template to_vector<U>(shift));
+            }
+            else {
+                const auto y0 = phases(blocks, p);
+                const auto y1 = phases(blocks, p + span);
+                const auto y2 = phases(blocks, p + 2 * span);
+                const auto y3 = phases(blocks, p + 3 * span);
+
+                using accum_type = std::remove_cvref_t<decltype(y0)>;
+
+                const auto a = add(y0, y2);
+                const auto b = sub(y0, y2);
+                const auto c = add(y1, y3);
+
+                // Inverse transforms rotate by j. The difference is rounded to the output precision and rotated with
+                // a single multiplication, so these outputs are rounded twice, and -32768 components saturate.
+                const vector<U, Lanes> e = sub(y1, y3).template to_vector<U>(shift);
+                const accum_type       d(mul(e, U{0, 1}).template to_vector<U>(), shift);
+
+                store_v(out + p,            add(a, c).template to_vector<U>(shift));
+                store_v(out + p + span,     add(b, d).template to_vector<U>(shift));
+                store_v(out + p + 2 * span, sub(a, c).template to_vector<U>(shift));
+                store_v(out + p + 3 * span, sub(b, d).template to_vector<U>(shift));
+            }
+        }
+    }
+
+    alignas(detail::vector_decl_align) CoeffType coeffs_[taps];
+    alignas(detail::vector_decl_align) T         history_[taps];
+    unsigned                                     pos_;
+};
+
+} // namespace aie
+
+#endif
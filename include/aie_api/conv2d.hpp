@@ -0,0 +1,337 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2022 Xilinx, Inc.
+// Copyright (C) 2022-2026 Advanced Micro Devices, Inc.
+
+/**
+ * @file
+ * @brief 2D convolutions computed with mmul directly on the input tensor, without im2col buffers.
+ */
+
+#pragma once
+
+#ifndef __AIE_API_CONV2D__HPP__
+#define __AIE_API_CONV2D__HPP__
+
+#include <numeric>
+
+#include "gemm.hpp"
+
+namespace aie {
+
+/**
+ * @ingroup group_mmul
+ *
+ * Memory layout of the input and output tensors of conv2d.
+ */
+enum class conv2d_layout
+{
+    nhwc,         ///< [height][width][channels]
+    nchw_blocked, ///< [channels / block][height][width][block], with the block size given by conv2d
+};
+
+namespace detail {
+
+// Loads Rows rows of Cols elements, which are RowStep elements apart in memory, into a row-major vector. The pointer
+// must be aligned to Cols elements.
+template <unsigned Rows, unsigned Cols, unsigned RowStep, typename T>
+__aie_inline
+static vector<T, Rows * Cols> conv2d_load_rows(const T *p)
+{
+    if constexpr (RowStep == Cols) {
+        return load_unaligned_v<Rows * Cols>(p, Cols);
+    }
+    else if constexpr (RowStep == 2 * Cols) {
+        return filter_even(load_unaligned_v<2 * Rows * Cols>(p, Cols), Cols);
+    }
+    else {
+        vector<T, Rows * Cols> ret;
+
+        if constexpr (Cols * type_bits_v<T> < 128) {
+            utils::unroll_times<Rows>([&](unsigned r) __aie_inline {
+                utils::unroll_times<Cols>([&](unsigned c) __aie_inline {
+                    ret.set(p[r * RowStep + c], r * Cols + c);
+                });
+            });
+        }
+        else {
+            utils::unroll_times<Rows>([&](unsigned r) __aie_inline {
+                ret.insert(r, load_unaligned_v<Cols>(p + r * RowStep, Cols));
+            });
+        }
+
+        return ret;
+    }
+}
+
+// Stores a row-major vector as Rows rows of Cols elements, which are RowStep elements apart in memory. The pointer must
+// be aligned to Cols elements.
+template <unsigned Rows, unsigned Cols, unsigned RowStep, typename T>
+__aie_inline
+static void conv2d_store_rows(T *p, const vector<T, Rows * Cols> &v)
+{
+    if constexpr (RowStep == Cols) {
+        store_unaligned_v(p, v, Cols);
+    }
+    else if constexpr (Cols * type_bits_v<T> < 128) {
+        utils::unroll_times<Rows>([&](unsigned r) __aie_inline {
+            utils::unroll_times<Cols>([&](unsigned c) __aie_inline {
+                p[r * RowStep + c] = v.get(r * Cols + c);
+            });
+        });
+    }
+    else {
+        utils::unroll_times<Rows>([&](unsigned r) __aie_inline {
+            store_unaligned_v(p + r * RowStep, v.template extract<Cols>(r), Cols);
+        });
+    }
+}
+
+} // namespace detail
+
+/**
+ * @ingroup group_mmul
+ *
+ * 2D convolution of a tensor of Cin channels with Cout filters of KH x KW taps, computed with mmul.
+ *
+ * The convolution is expressed as a matrix multiplication whose A matrix is the im2col expansion of the input, but the
+ * expansion is never written to memory: each MxK tile of A holds M consecutive output pixels of a row and K input
+ * channels of one tap of the filters, and it is loaded directly from the input tensor. For each tile of outputs, the
+ * taps and the input channels are traversed while the accumulators of a grid of output tiles are kept in registers
+ * (see gemm_config), and the results are passed to a gemm epilogue before they are stored, so requantization and
+ * activation functions do not need an additional pass over the output.
+ *
+ * The convolution is computed without padding, so the caller provides an input that includes the borders:
+ *
+ * @code
+ * out[oy][ox][co] = sum(in[oy * Stride + kh * Dilation][ox * Stride + kw * Dilation][ci] * w[co][kh][kw][ci])
+ * @endcode
+ *
+ * The number of rows of each A tile that are loaded with a single vector load depends on the layout. With
+ * conv2d_layout::nchw_blocked, whose input channel blocks have the same size as the K dimension of the mmul shape
+ * (in_block), the tiles of stride-1 convolutions are contiguous in memory and the tiles of stride-2 convolutions are
+ * loaded with a vector load of twice the size followed by filter_even, which may read up to in_block elements past the
+ * last input pixel. With conv2d_layout::nhwc, the rows of a tile are Cin elements apart and are loaded one by one,
+ * unless Cin matches in_block. The same applies to the output tiles, whose channel blocks have the size of the N
+ * dimension of the mmul shape (out_block) in the blocked layout.
+ *
+ * The weights are stored in the tiled layout of the mmul shape, which is produced by pack_weights.
+ *
+ * @code
+ * using conv = aie::conv2d<3, 3, 32, 64, int8, int8, aie::conv2d_layout::nchw_blocked>;
+ *
+ * alignas(aie::vector_decl_align) static int8 packed[conv::weights_size];
+ *
+ * conv::pack_weights(weights, packed);
+ * conv::run(in, packed, out, in_height, in_width, shift);
+ * @endcode
+ *
+ * @tparam KH       Rows of the filters.
+ * @tparam KW       Columns of the filters.
+ * @tparam Cin      Number of input channels. It must be a multiple of in_block.
+ * @tparam Cout     Number of output channels. It must be a multiple of out_block.
+ * @tparam T        Type of the elements of the input tensor.
+ * @tparam TypeW    Type of the weights.
+ * @tparam Layout   Layout of the input and output tensors.
+ * @tparam Stride   Distance between the input pixels of consecutive output pixels, in both dimensions.
+ * @tparam Dilation Distance between the input pixels of consecutive taps of the filters, in both dimensions.
+ * @tparam AccumTag Accumulator tag used for the multiplications.
+ */
+template <unsigned KH, unsigned KW, unsigned Cin, unsigned Cout, typename T, typename TypeW = T,
+          conv2d_layout Layout = conv2d_layout::nhwc, unsigned Stride = 1, unsigned Dilation = 1,
+          AccumElemBaseType AccumTag = accauto>
+    requires(detail::gemm_default_shape<T, TypeW>()[0] != 0 && KH > 0 && KW > 0 && Stride > 0 && Dilation > 0)
+class conv2d
+{
+    static constexpr auto shape = detail::gemm_default_shape<T, TypeW>();
+
+    using config = gemm_config<shape[0], shape[1], shape[2], T, TypeW, AccumTag>;
+
+public:
+    /** mmul type used to multiply each pair of tiles */
+    using mmul_type = typename config::mmul_type;
+
+    /** Size of the channel blocks of the input tensor in conv2d_layout::nchw_blocked */
+    static constexpr unsigned in_block  = shape[1];
+    /** Size of the channel blocks of the output tensor in conv2d_layout::nchw_blocked */
+    static constexpr unsigned out_block = shape[2];
+
+    static_assert(Cin  % in_block  == 0, "The number of input channels must be a multiple of in_block");
+    static_assert(Cout % out_block == 0, "The number of output channels must be a multiple of out_block");
+
+    /** Number of output tiles of consecutive pixels computed at the same time */
+    static constexpr unsigned grid_pixels   = config::grid_rows;
+    /** Number of output tiles of consecutive channels computed at the same time */
+    static constexpr unsigned grid_channels = std::gcd(config::grid_cols, Cout / out_block);
+
+    /** The output width must be a multiple of this value */
+    static constexpr unsigned pixels_multiple = shape[0] * grid_pixels;
+
+    /** Number of weights, which is also the number of elements written by pack_weights */
+    static constexpr unsigned weights_size = KH * KW * Cin * Cout;
+
+    /**
+     * Returns the output height for the given input height.
+     *
+     * @param in_height Rows of the input tensor, including the borders.
+     */
+    static constexpr unsigned out_height(unsigned in_height)
+    {
+        return (in_height - Dilation * (KH - 1) - 1) / Stride + 1;
+    }
+
+    /**
+     * Returns the output width for the given input width.
+     *
+     * @param in_width Columns of the input tensor, including the borders.
+     */
+    static constexpr unsigned out_width(unsigned in_width)
+    {
+        return (in_width - Dilation * (KW - 1) - 1) / Stride + 1;
+    }
+
+    /**
+     * Reorders the weights into the tiled layout used by run. This is meant to be done once, when the kernel is
+     * initialized, or offline.
+     *
+     * @param weights Weights in [Cout][KH][KW][Cin] order.
+     * @param packed  Output buffer of weights_size elements, which is passed to run. It must be aligned to the size of
+     *                a tile.
+     */
+    static void pack_weights(const TypeW * __restrict weights, TypeW * __restrict packed)
+    {
+        constexpr unsigned K = in_block;
+        constexpr unsigned N = out_block;
+
+        for (unsigned co = 0; co < Cout; ++co)
+            for (unsigned kh = 0; kh < KH; ++kh)
+                for (unsigned kw = 0; kw < KW; ++kw)
+                    for (unsigned ci = 0; ci < Cin; ++ci) {
+                        const unsigned tile = (((co / N) * KH + kh) * KW + kw) * (Cin / K) + ci / K;
+
+                        packed[tile * K * N + (ci % K) * N + co % N] = weights[((co * KH + kh) * KW + kw) * Cin + ci];
+                    }
+    }
+
+    /**
+     * Computes the convolution of a tensor.
+     *
+     * @param in        Input tensor, with the layout given by Layout. It must be aligned to vector_decl_align.
+     * @param weights   Weights reordered by pack_weights. It must be aligned to the size of a tile.
+     * @param out       Output tensor, with the layout given by Layout. It must be aligned to vector_decl_align.
+     * @param in_height Rows of the input tensor, including the borders.
+     * @param in_width  Columns of the input tensor, including the borders. The resulting out_width must be a multiple
+     *                  of pixels_multiple.
+     * @param epilogue  Function that converts the result of each output tile to TypeC (see gemm_shift_epilogue).
+     *                  It receives the index of the first output pixel of the tile (oy * out_width + ox) as the row
+     *                  and its first output channel as the column, so per-channel parameters use
+     *                  gemm_channels::per_col.
+     */
+    template <typename TypeC, typename Epilogue>
+        requires(std::is_class_v<std::remove_cvref_t<Epilogue>>)
+    static void run(const T * __restrict in, const TypeW * __restrict weights, TypeC * __restrict out,
+                    unsigned in_height, unsigned in_width, Epilogue &&epilogue)
+    {
+        using MMUL = mmul_type;
+
+        constexpr unsigned M    = shape[0];
+        constexpr unsigned K    = in_block;
+        constexpr unsigned N    = out_block;
+        constexpr unsigned Rows = grid_pixels;
+        constexpr unsigned Cols = grid_channels;
+
+        constexpr bool     blocked    = Layout == conv2d_layout::nchw_blocked;
+        // Distance between consecutive input and output pixels of a row
+        constexpr unsigned in_pixel   = blocked? K : Cin;
+        constexpr unsigned out_pixel  = blocked? N : Cout;
+        // Number of weight tiles of each block of output channels
+        constexpr unsigned taps_tiles = KH * KW * (Cin / K);
+
+        const unsigned oh = out_height(in_height);
+        const unsigned ow = out_width(in_width);
+
+        REQUIRES_MSG(ow % pixels_multiple == 0, "The output width must be a multiple of the accumulator grid");
+
+        // Distance between input rows, and between consecutive input and output channel blocks
+        const unsigned in_row         = in_width * in_pixel;
+        const unsigned in_block_step  = blocked? in_height * in_width * K : K;
+        const unsigned out_block_step = blocked? oh * ow * N : N;
+
+        for (unsigned oy = 0; oy < oh; ++oy)
+            chess_loop_range(1,)
+        {
+            for (unsigned ox = 0; ox < ow; ox += M * Rows)
+                chess_loop_range(1,)
+            {
+                for (unsigned co = 0; co < Cout / N; co += Cols)
+                    chess_loop_range(1,)
+                {
+                    const TypeW * __restrict pB = weights + co * taps_tiles * MMUL::size_B;
+
+                    // Default constructed accumulators are treated as zero by the first mac
+                    std::array<MMUL, Rows * Cols> acc;
+
+                    for (unsigned kh = 0; kh < KH; ++kh) {
+                        for (unsigned kw = 0; kw < KW; ++kw) {
+                            const T * __restrict pA = in + (oy * Stride + kh * Dilation) * in_row
+                                                         + (ox * Stride + kw * Dilation) * in_pixel;
+
+                            for (unsigned ci = 0; ci < Cin / K; ++ci)
+                                chess_prepare_for_pipelining
+                                chess_loop_range(1,)
+                            {
+                                std::array<vector<T,     MMUL::size_A>, Rows> a;
+                                std::array<vector<TypeW, MMUL::size_B>, Cols> b;
+
+                                detail::utils::unroll_times<Rows>([&](unsigned r) __aie_inline {
+                                    a[r] = detail::conv2d_load_rows<M, K, Stride * in_pixel>(pA + r * M * Stride *
+                                                                                                  in_pixel);
+                                });
+                                detail::utils::unroll_times<Cols>([&](unsigned c) __aie_inline {
+                                    b[c] = load_v<MMUL::size_B>(pB + c * taps_tiles * MMUL::size_B);
+                                });
+
+                                detail::utils::unroll_times<Rows>([&](unsigned r) __aie_inline {
+                                    detail::utils::unroll_times<Cols>([&](unsigned c) __aie_inline {
+                                        acc[r * Cols + c].mac(a[r], b[c]);
+                                    });
+                                });
+
+                                pA += in_block_step;
+                                pB += MMUL::size_B;
+                            }
+                        }
+                    }
+
+                    detail::utils::unroll_times<Rows>([&](unsigned r) __aie_inline {
+                        const unsigned x = ox + r * M;
+
+                        detail::utils::unroll_times<Cols>([&](unsigned c) __aie_inline {
+                            TypeC * __restrict pC = out + (co + c) * out_block_step + (oy * ow + x) * out_pixel;
+
+                            detail::conv2d_store_rows<M, N, out_pixel>(pC, epilogue(acc[r * Cols + c], oy * ow + x,
+                                                                                    (co + c) * N));
+                        });
+                    });
+                }
+            }
+        }
+    }
+
+    /**
+     * Computes the convolution of a tensor, converting the results to TypeC with the given shift.
+     *
+     * See the run overload with an epilogue for a description of the parameters.
+     *
+     * @param shift Downshift applied to the results. Ignored for floating point types.
+     */
+    template <typename TypeC>
+    static void run(const T * __restrict in, const TypeW * __restrict weights, TypeC * __restrict out,
+                    unsigned in_height, unsigned in_width, int shift = 0)
+    {
+        run(in, weights, out, in_height, in_width, gemm_shift_epilogue<TypeC>{shift});
+    }
+};
+
+} // namespace aie
+
+#endif
@@ -12,7 +12,7 @@
 namespace aie::detail {
 
 template <>
-struct cfr<cint16>
+struct cfr<cint16> : cfr_peak_search<cint16>
 {
     using accum_tag = accum_tag_for_type<cint16, 48>;
     using acc_type = accum<accum_tag, 8>;
@@ -14,14 +14,16 @@ namespace aie::detail {
     {
         static constexpr unsigned radix = 2;
 
+        template <typename Epilogue = fft_identity_epilogue<Output>>
         __aie_inline
         static void run(const Input * __restrict x,
                         const Twiddle * __restrict tw0,
-                        unsigned n, unsigned shift_tw, unsigned shift, bool inv, Output * __restrict out)
+                        unsigned n, unsigned shift_tw, unsigned shift, bool inv,
+                        fft_epilogue_output_t<Epilogue> * __restrict out, Epilogue &&epilogue = {})
         {
             constexpr unsigned stage = fft_get_stage<Input, Output, Twiddle>(radix, Vectorization);
             using FFT = fft_dit<Vectorization, stage, radix, Input, Output, Twiddle>;
-            using iterator = restrict_vector_iterator<Output, FFT::out_vector_size, 1, aie_dm_resource::none>;
+            using iterator = restrict_vector_iterator<fft_epilogue_output_t<Epilogue>, FFT::out_vector_size, 1, aie_dm_resource::none>;
 
             FFT fft(shift_tw, shift, inv);
 
@@ -36,8 +38,8 @@ namespace aie::detail {
                 chess_loop_range(1,)
             {
                 const auto out = fft.dit(*it_stage++);
-                *it_out0++ = out[0];
-                *it_out1++ = out[1];
+                *it_out0++ = epilogue(out[0]);
+                *it_out1++ = epilogue(out[1]);
             }
         }
     };
@@ -48,15 +50,17 @@ namespace aie::detail {
         static constexpr unsigned radix = 3;
         static constexpr unsigned one_third_Q15 = 10923;
 
+        template <typename Epilogue = fft_identity_epilogue<Output>>
         __aie_inline
         static void run(const Input * __restrict x,
                         const Twiddle * __restrict tw0,
                         const Twiddle * __restrict tw1,
-                        unsigned n, unsigned shift_tw, unsigned shift, bool inv, Output * __restrict out)
+                        unsigned n, unsigned shift_tw, unsigned shift, bool inv,
+                        fft_epilogue_output_t<Epilogue> * __restrict out, Epilogue &&epilogue = {})
         {
             constexpr unsigned stage = fft_get_stage<Input, Output, Twiddle>(radix, Vectorization);
             using FFT = fft_dit<Vectorization, stage, radix, Input, Output, Twiddle>;
-            using iterator = restrict_vector_iterator<Output, FFT::out_vector_size, 1, aie_dm_resource::none>;
+            using iterator = restrict_vector_iterator<fft_epilogue_output_t<Epilogue>, FFT::out_vector_size, 1, aie_dm_resource::none>;
 
             FFT fft(shift_tw, shift, inv);
 
@@ -74,9 +78,9 @@ namespace aie::detail {
                 chess_loop_range(1,)
             {
                 const auto out = fft.dit(*it_stage++);
-                *it_out0++ = out[0];
-                *it_out1++ = out[1];
-                *it_out2++ = out[2];
+                *it_out0++ = epilogue(out[0]);
+                *it_out1++ = epilogue(out[1]);
+                *it_out2++ = epilogue(out[2]);
             }
         }
     };
@@ -86,16 +90,18 @@ namespace aie::detail {
     {
         static constexpr unsigned radix = 4;
 
+        template <typename Epilogue = fft_identity_epilogue<Output>>
         __aie_inline
         static void run(const Input * __restrict x,
                         const Twiddle * __restrict tw0,
                         const Twiddle * __restrict tw1,
                         const Twiddle * __restrict /*tw2*/,
-                        unsigned n, unsigned shift_tw, unsigned shift, bool inv, Output * out)
+                        unsigned n, unsigned shift_tw, unsigned shift, bool inv,
+                        fft_epilogue_output_t<Epilogue> * out, Epilogue &&epilogue = {})
         {
             constexpr unsigned stage = fft_get_stage<Input, Output, Twiddle>(radix, Vectorization);
             using FFT = fft_dit<Vectorization, stage, radix, Input, Output, Twiddle>;
-            using iterator = restrict_vector_iterator<Output, FFT::out_vector_size, 1, aie_dm_resource::none>;
+            using iterator = restrict_vector_iterator<fft_epilogue_output_t<Epilogue>, FFT::out_vector_size, 1, aie_dm_resource::none>;
 
             FFT fft(shift_tw, shift, inv);
 
@@ -114,10 +120,10 @@ namespace aie::detail {
                     chess_loop_range(1,)
                 {
                     const auto out = fft.dit(*it_stage++);
-                    *it_out0++ = out[0];
-                    *it_out1++ = out[1];
-                    *it_out2++ = out[2];
-                    *it_out3++ = out[3];
+                    *it_out0++ = epilogue(out[0]);
+                    *it_out1++ = epilogue(out[1]);
+                    *it_out2++ = epilogue(out[2]);
+                    *it_out3++ = epilogue(out[3]);
                 }
             }
             else { //Currently worse performance if using the 4 pointer version on Vectorization > 1
@@ -129,10 +135,10 @@ namespace aie::detail {
                     chess_loop_range(1,)
                 {
                     const auto out = fft.dit(*it_stage++);
-                    *it_out0 = out[0]; it_out0 +=  block_size;
-                    *it_out0 = out[1]; it_out0 += -block_size + 1;
-                    *it_out1 = out[2]; it_out1 +=  block_size;
-                    *it_out1 = out[3]; it_out1 += -block_size + 1;
+                    *it_out0 = epilogue(out[0]); it_out0 +=  block_size;
+                    *it_out0 = epilogue(out[1]); it_out0 += -block_size + 1;
+                    *it_out1 = epilogue(out[2]); it_out1 +=  block_size;
+                    *it_out1 = epilogue(out[3]); it_out1 += -block_size + 1;
                 }
             }
         }
@@ -143,17 +149,19 @@ namespace aie::detail {
     {
         static constexpr unsigned radix = 5;
 
+        template <typename Epilogue = fft_identity_epilogue<Output>>
         __aie_inline
         static void run(const Input * __restrict x,
                         const Twiddle * __restrict tw0,
                         const Twiddle * __restrict tw1,
                         const Twiddle * __restrict tw2,
                         const Twiddle * __restrict tw3,
-                        unsigned n, unsigned shift_tw, unsigned shift, bool inv, Output * __restrict out)
+                        unsigned n, unsigned shift_tw, unsigned shift, bool inv,
+                        fft_epilogue_output_t<Epilogue> * __restrict out, Epilogue &&epilogue = {})
         {
             constexpr unsigned stage = fft_get_stage<Input, Output, Twiddle>(radix, Vectorization);
             using FFT = fft_dit<Vectorization, stage, radix, Input, Output, Twiddle>;
-            using iterator = restrict_vector_iterator<Output, FFT::out_vector_size, 1, aie_dm_resource::none>;
+            using iterator = restrict_vector_iterator<fft_epilogue_output_t<Epilogue>, FFT::out_vector_size, 1, aie_dm_resource::none>;
 
             FFT fft(shift_tw, shift, inv);
 
@@ -168,11 +176,11 @@ namespace aie::detail {
                 chess_loop_range(1,)
             {
                 const auto out = fft.dit(*it_stage++);
-                *it_out = out[0]; it_out +=    block_size;
-                *it_out = out[1]; it_out +=    block_size;
-                *it_out = out[2]; it_out +=    block_size;
-                *it_out = out[3]; it_out +=    block_size;
-                *it_out = out[4]; it_out += -4*block_size + 1;
+                *it_out = epilogue(out[0]); it_out +=    block_size;
+                *it_out = epilogue(out[1]); it_out +=    block_size;
+                *it_out = epilogue(out[2]); it_out +=    block_size;
+                *it_out = epilogue(out[3]); it_out +=    block_size;
+                *it_out = epilogue(out[4]); it_out += -4*block_size + 1;
             }
         }
     };
@@ -184,26 +192,28 @@ namespace aie::detail {
     {
         static constexpr unsigned radix = 2;
 
+        template <typename Epilogue = fft_identity_epilogue<Output>>
         __aie_inline
         static void run(const Input * __restrict x,
                         const Twiddle * __restrict tw0,
                         unsigned n, unsigned vectorization,
-                        unsigned shift_tw, unsigned shift, bool inv, Output * __restrict out)
+                        unsigned shift_tw, unsigned shift, bool inv,
+                        fft_epilogue_output_t<Epilogue> * __restrict out, Epilogue &&epilogue = {})
         {
             if (vectorization == 1) {
-                fft_dit_stage<radix, 1, Input, Output, Twiddle>::run(x, tw0, n, shift_tw, shift, inv, out);
+                fft_dit_stage<radix, 1, Input, Output, Twiddle>::run(x, tw0, n, shift_tw, shift, inv, out, epilogue);
             }
             else if (vectorization == 2) {
-                fft_dit_stage<radix, 2, Input, Output, Twiddle>::run(x, tw0, n, shift_tw, shift, inv, out);
+                fft_dit_stage<radix, 2, Input, Output, Twiddle>::run(x, tw0, n, shift_tw, shift, inv, out, epilogue);
             }
             else if (std::is_same_v<Input, cint16> && vectorization == 4) {
-                fft_dit_stage<radix, 4, Input, Output, Twiddle>::run(x, tw0, n, shift_tw, shift, inv, out);
+                fft_dit_stage<radix, 4, Input, Output, Twiddle>::run(x, tw0, n, shift_tw, shift, inv, out, epilogue);
             }
             else {
                 constexpr unsigned vec_dummy = 8;
                 constexpr unsigned stage = 0;
                 using FFT = fft_dit<vec_dummy, stage, radix, Input, Output, Twiddle>;
-                using iterator = restrict_vector_iterator<Output, FFT::out_vector_size, 1, aie_dm_resource::none>;
+                using iterator = restrict_vector_iterator<fft_epilogue_output_t<Epilogue>, FFT::out_vector_size, 1, aie_dm_resource::none>;
 
                 FFT fft(shift_tw, shift, inv);
 
@@ -218,8 +228,8 @@ namespace aie::detail {
                     chess_loop_range(1,)
                 {
                     const auto out = fft.dit(*it_stage++);
-                    *it_out0++ = out[0];
-                    *it_out1++ = out[1];
+                    *it_out0++ = epilogue(out[0]);
+                    *it_out1++ = epilogue(out[1]);
                 }
             }
         }
@@ -231,12 +241,14 @@ namespace aie::detail {
         static constexpr unsigned radix = 3;
         static constexpr unsigned one_third_Q15 = 10923;
 
+        template <typename Epilogue = fft_identity_epilogue<Output>>
         __aie_inline
         static void run(const Input * __restrict x,
                         const Twiddle * __restrict tw0,
                         const Twiddle * __restrict tw1,
                         unsigned n, unsigned vectorization,
-                        unsigned shift_tw, unsigned shift, bool inv, Output * __restrict out)
+                        unsigned shift_tw, unsigned shift, bool inv,
+                        fft_epilogue_output_t<Epilogue> * __restrict out, Epilogue &&epilogue = {})
         {
             if constexpr (std::is_same_v<Twiddle, cint32>)
                 REQUIRES_MSG(vectorization >= 2, "Only vectorizations >= 2 are supported");
@@ -246,7 +258,7 @@ namespace aie::detail {
             constexpr unsigned vec_dummy = 4;
             constexpr unsigned stage = 0;
             using FFT = fft_dit<vec_dummy, stage, radix, Input, Output, Twiddle>;
-            using iterator = restrict_vector_iterator<Output, FFT::out_vector_size, 1, aie_dm_resource::none>;
+            using iterator = restrict_vector_iterator<fft_epilogue_output_t<Epilogue>, FFT::out_vector_size, 1, aie_dm_resource::none>;
 
             FFT fft(shift_tw, shift, inv);
 
@@ -264,9 +276,9 @@ namespace aie::detail {
                 chess_loop_range(1,)
             {
                 const auto out = fft.dit(*it_stage++);
-                *it_out0++ = out[0];
-                *it_out1++ = out[1];
-                *it_out2++ = out[2];
+                *it_out0++ = epilogue(out[0]);
+                *it_out1++ = epilogue(out[1]);
+                *it_out2++ = epilogue(out[2]);
             }
         }
     };
@@ -276,22 +288,24 @@ namespace aie::detail {
     {
         static constexpr unsigned radix = 4;
 
+        template <typename Epilogue = fft_identity_epilogue<Output>>
         __aie_inline
         static void run(const Input * __restrict x,
                         const Twiddle * __restrict tw0,
                         const Twiddle * __restrict tw1,
                         const Twiddle * __restrict tw2,
                         unsigned n, unsigned vectorization,
-                        unsigned shift_tw, unsigned shift, bool inv, Output * out)
+                        unsigned shift_tw, unsigned shift, bool inv,
+                        fft_epilogue_output_t<Epilogue> * out, Epilogue &&epilogue = {})
         {
             if (vectorization == 1) {
-                fft_dit_stage<radix, 1, Input, Output, Twiddle>::run(x, tw0, tw1, tw2, n, shift_tw, shift, inv, out);
+                fft_dit_stage<radix, 1, Input, Output, Twiddle>::run(x, tw0, tw1, tw2, n, shift_tw, shift, inv, out, epilogue);
             }
             else {
                 constexpr unsigned vec_dummy = 4;
                 constexpr unsigned stage = 0;
                 using FFT = fft_dit<vec_dummy, stage, radix, Input, Output, Twiddle>;
-                using iterator = restrict_vector_iterator<Output, FFT::out_vector_size, 1, aie_dm_resource::none>;
+                using iterator = restrict_vector_iterator<fft_epilogue_output_t<Epilogue>, FFT::out_vector_size, 1, aie_dm_resource::none>;
 
                 FFT fft(shift_tw, shift, inv);
 
@@ -307,10 +321,10 @@ namespace aie::detail {
                     chess_loop_range(1,)
                 {
                     const auto out = fft.dit(*it_stage++);
-                    *it_out0 = out[0]; it_out0 +=  block_size;
-                    *it_out0 = out[1]; it_out0 += -block_size + 1;
-                    *it_out1 = out[2]; it_out1 +=  block_size;
-                    *it_out1 = out[3]; it_out1 += -block_size + 1;
+                    *it_out0 = epilogue(out[0]); it_out0 +=  block_size;
+                    *it_out0 = epilogue(out[1]); it_out0 += -block_size + 1;
+                    *it_out1 = epilogue(out[2]); it_out1 +=  block_size;
+                    *it_out1 = epilogue(out[3]); it_out1 += -block_size + 1;
                 }
             }
         }
@@ -321,6 +335,7 @@ namespace aie::detail {
     {
         static constexpr unsigned radix = 5;
 
+        template <typename Epilogue = fft_identity_epilogue<Output>>
         __aie_inline
         static void run(const Input * __restrict x,
                         const Twiddle * __restrict tw0,
@@ -328,7 +343,8 @@ namespace aie::detail {
                         const Twiddle * __restrict tw2,
                         const Twiddle * __restrict tw3,
                         unsigned n, unsigned vectorization,
-                        unsigned shift_tw, unsigned shift, bool inv, Output * __restrict out)
+                        unsigned shift_tw, unsigned shift, bool inv,
+                        fft_epilogue_output_t<Epilogue> * __restrict out, Epilogue &&epilogue = {})
         {
             if constexpr (std::is_same_v<Twiddle, cint32>)
                 REQUIRES_MSG(vectorization >= 2, "Only vectorizations >= 2 are supported");
@@ -338,7 +354,7 @@ namespace aie::detail {
             constexpr unsigned vec_dummy = 4;
             constexpr unsigned stage = 0;
             using FFT = fft_dit<vec_dummy, stage, radix, Input, Output, Twiddle>;
-            using iterator = restrict_vector_iterator<Output, FFT::out_vector_size, 1, aie_dm_resource::none>;
+            using iterator = restrict_vector_iterator<fft_epilogue_output_t<Epilogue>, FFT::out_vector_size, 1, aie_dm_resource::none>;
 
             FFT fft(shift_tw, shift, inv);
 
@@ -353,11 +369,11 @@ namespace aie::detail {
                 chess_loop_range(1,)
             {
                 const auto out = fft.dit(*it_stage++);
-                *it_out = out[0]; it_out +=    block_size;
-                *it_out = out[1]; it_out +=    block_size;
-                *it_out = out[2]; it_out +=    block_size;
-                *it_out = out[3]; it_out +=    block_size;
-                *it_out = out[4]; it_out += -4*block_size + 1;
+                *it_out = epilogue(out[0]); it_out +=    block_size;
+                *it_out = epilogue(out[1]); it_out +=    block_size;
+                *it_out = epilogue(out[2]); it_out +=    block_size;
+                *it_out = epilogue(out[3]); it_out +=    block_size;
+                *it_out = epilogue(out[4]); it_out += -4*block_size + 1;
             }
         }
     };
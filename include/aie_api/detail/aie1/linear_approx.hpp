@@ -0,0 +1,86 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2022 Xilinx, Inc.
+// Copyright (C) 2022-2026 Advanced Micro Devices, Inc.
+
+#pragma once
+
+#ifndef __AIE_API_DETAIL_AIE1_LINEAR_APPROX_HPP__
+#define __AIE_API_DETAIL_AIE1_LINEAR_APPROX_HPP__
+
+#include "../accum.hpp"
+#include "../lut.hpp"
+#include "../mul.hpp"
+#include "../utils.hpp"
+
+#include "parallel_lookup.hpp"
+
+namespace aie::detail {
+
+/* The slope/offset pairs are gathered like in parallel_lookup, together with the remainders of the inputs, and the
+ * approximation is computed with one vector multiply-accumulate. AIE has no 8b x 8b element-wise multiplications, so
+ * int8 slopes and remainders are gathered into int16 vectors, and the accumulators are acc48 (acc80 for int32 tables).
+ */
+template <typename T, unsigned ParallelAccesses, typename OffsetType>
+    requires(utils::is_one_of_v<T, int8, int16> && utils::is_one_of_v<OffsetType, int8, int16, int32>)
+struct linear_approx<T, lut<ParallelAccesses, OffsetType, OffsetType>>
+{
+    using MyLUT = lut<ParallelAccesses, OffsetType, OffsetType>;
+
+    // 8b values are stored as 16b values
+    using value_type = std::conditional_t<std::is_same_v<OffsetType, int32>, int32, int16>;
+
+    static constexpr unsigned accum_bits = std::is_same_v<OffsetType, int32>? 80 : 48;
+
+    template <unsigned Lanes>
+    using accum_type = accum<std::conditional_t<accum_bits == 80, acc80, acc48>, Lanes>;
+
+public:
+    __aie_inline
+    linear_approx(const MyLUT &l, unsigned step_bits, int bias = 0, int shift_offset = 0) :
+        gather_(l),
+        step_bits_(step_bits),
+        bias_(bias),
+        shift_offset_(shift_offset),
+        idx_max_(l.LUT_elems_ - 1)
+    {
+    }
+
+    template <typename Vec>
+    __aie_inline
+    accum_type<Vec::size()> compute(const Vec &input)
+    {
+        constexpr unsigned N = Vec::size();
+
+        vector<value_type, N> slope, offset;
+        vector<int16, N>      remainder;
+
+        utils::unroll_times<N>([&](unsigned i) __aie_inline {
+            const int x = input.get(i);
+            const int q = x >> step_bits_;
+
+            const unsigned idx = unsigned(std::min(std::max(q + bias_, 0), int(idx_max_)));
+
+            const value_type *entry = gather_.entry(idx, i);
+
+            slope.set(entry[0], i);
+            offset.set(entry[1], i);
+            remainder.set(int16(x - (q << step_bits_)), i);
+        });
+
+        accum_type<N> acc;
+        acc.from_vector(offset, shift_offset_);
+
+        return mul<MulMacroOp::Add_Mul, accum_bits, value_type, int16>::run(slope, true, remainder, true, acc);
+    }
+
+private:
+    lut_gather<ParallelAccesses, value_type, 2> gather_;
+    int      step_bits_;
+    int      bias_;
+    int      shift_offset_;
+    unsigned idx_max_;
+};
+
+}
+
+#endif
@@ -7,6 +7,8 @@
 #ifndef __AIE_API_DETAIL_AIE1_LOCK__HPP__
 #define __AIE_API_DETAIL_AIE1_LOCK__HPP__
 
+#include <array>
+
 namespace aie::detail {
 
 class mutex {
@@ -37,13 +39,14 @@ public:
     }
 };
 
+// AIE locks are binary, so producers keep one lock per reader for each buffer, and consumers one lock per writer
 template <unsigned Readers, unsigned Writers>
 class producer_sem {
 private:
-    const unsigned lock_id_;
+    const std::array<unsigned, Readers> lock_ids_;
 
-    static_assert(Readers == 1);
-    static_assert(Writers == 1);
+    static_assert(Readers > 0);
+    static_assert(Writers > 0);
 
     producer_sem()                                = delete;
     producer_sem(const producer_sem &)            = delete;
@@ -55,16 +58,25 @@ private:
 public:
     void lock()
     {
-        ::acquire(lock_id_, 0);
+        utils::unroll_times<Readers>([&](unsigned r) __aie_inline {
+            ::acquire(lock_ids_[r], 0);
+        });
     }
 
     void unlock()
     {
-        ::release(lock_id_, 1);
+        utils::unroll_times<Readers>([&](unsigned r) __aie_inline {
+            ::release(lock_ids_[r], 1);
+        });
     }
 
-    producer_sem(unsigned lock_id) :
-        lock_id_(lock_id)
+    producer_sem(unsigned lock_id) requires(Readers == 1) :
+        lock_ids_{lock_id}
+    {
+    }
+
+    producer_sem(const std::array<unsigned, Readers> &lock_ids) :
+        lock_ids_(lock_ids)
     {
     }
 };
@@ -72,10 +84,10 @@ public:
 template <unsigned Readers, unsigned Writers>
 class consumer_sem {
 private:
-    const unsigned lock_id_;
+    const std::array<unsigned, Writers> lock_ids_;
 
-    static_assert(Readers == 1);
-    static_assert(Writers == 1);
+    static_assert(Readers > 0);
+    static_assert(Writers > 0);
 
     consumer_sem()                                = delete;
     consumer_sem(const consumer_sem &)            = delete;
@@ -87,16 +99,25 @@ private:
 public:
     void lock()
     {
-        ::acquire(lock_id_, 1);
+        utils::unroll_times<Writers>([&](unsigned w) __aie_inline {
+            ::acquire(lock_ids_[w], 1);
+        });
     }
 
     void unlock()
     {
-        ::release(lock_id_, 0);
+        utils::unroll_times<Writers>([&](unsigned w) __aie_inline {
+            ::release(lock_ids_[w], 0);
+        });
     }
 
-    consumer_sem(unsigned lock_id) :
-        lock_id_(lock_id)
+    consumer_sem(unsigned lock_id) requires(Writers == 1) :
+        lock_ids_{lock_id}
+    {
+    }
+
+    consumer_sem(const std::array<unsigned, Writers> &lock_ids) :
+        lock_ids_(lock_ids)
     {
     }
 };
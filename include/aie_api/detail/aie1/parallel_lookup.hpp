@@ -0,0 +1,133 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2022 Xilinx, Inc.
+// Copyright (C) 2022-2026 Advanced Micro Devices, Inc.
+
+#pragma once
+
+#ifndef __AIE_API_DETAIL_AIE1_PARALLEL_LOOKUP_HPP__
+#define __AIE_API_DETAIL_AIE1_PARALLEL_LOOKUP_HPP__
+
+#include "../lut.hpp"
+#include "../utils.hpp"
+
+namespace aie::detail {
+
+/* Lookups on AIE
+ *
+ * AIE has no lookup-table loads, and its vector permutations take their offsets from configuration registers rather
+ * than from the data, so the values cannot be gathered within the vector registers. Instead, each lane is read with a
+ * scalar load and inserted in the result vector.
+ *
+ * AIE has two load units. The tables laid out for parallel accesses hold two copies of each bank-width line, in
+ * different banks, so consecutive lanes read from different copies and the two loads of a cycle do not conflict. Tables
+ * for four parallel accesses are used as two tables of two copies. The index computations are done in the scalar
+ * unit, in parallel with the loads.
+ */
+template <unsigned ParallelAccesses, typename Storage, unsigned EntryValues>
+struct lut_gather
+{
+    static constexpr unsigned entry_bytes = EntryValues * sizeof(Storage);
+
+    template <typename MyLUT>
+    lut_gather(const MyLUT &l)
+    {
+        if constexpr (ParallelAccesses == 4) {
+            tables_[0] = (const Storage *) l.LUT_ab_;
+            tables_[1] = (const Storage *) l.LUT_cd_;
+        }
+        else if constexpr (ParallelAccesses == 2) {
+            tables_[0] = tables_[1] = (const Storage *) l.LUT_ab_;
+        }
+        else {
+            tables_[0] = tables_[1] = (const Storage *) l.LUT_a_;
+        }
+    }
+
+    // Returns a pointer to the EntryValues values of the given entry, read by the given lane
+    __aie_inline
+    const Storage *entry(unsigned idx, unsigned lane) const
+    {
+        if constexpr (ParallelAccesses == 4)
+            return tables_[lane % 2] + EntryValues * lut_interleaved_offset<entry_bytes>(idx, (lane / 2) % 2);
+        else if constexpr (ParallelAccesses == 2)
+            return tables_[0] + EntryValues * lut_interleaved_offset<entry_bytes>(idx, lane % 2);
+        else
+            return tables_[0] + EntryValues * idx;
+    }
+
+    const Storage *tables_[2];
+};
+
+template <typename T, unsigned ParallelAccesses, typename OffsetType, lut_oor_policy oor_policy>
+struct parallel_lookup<T, lut<ParallelAccesses, OffsetType, OffsetType>, oor_policy>
+{
+    using MyLUT = lut<ParallelAccesses, OffsetType, OffsetType>;
+
+    // 8b values are stored as 16b values
+    using storage_type = std::conditional_t<type_bits_v<OffsetType> == 8,
+                                            std::conditional_t<std::is_signed_v<OffsetType>, int16, uint16>,
+                                            OffsetType>;
+
+    __aie_inline
+    parallel_lookup(const MyLUT &l, unsigned step_bits = 0, unsigned bias = 0) :
+        gather_(l),
+        step_bits_(step_bits),
+        bias_(bias),
+        idx_max_(l.LUT_elems_ - 1)
+    {
+    }
+
+    template <typename Vec, unsigned N = Vec::size()>
+        requires(N <= Vec::size())
+    __aie_inline
+    vector<OffsetType, N> fetch(const Vec &input)
+    {
+        vector<OffsetType, N> result;
+
+        utils::unroll_times<N>([&](unsigned i) __aie_inline {
+            result.set(OffsetType(*gather_.entry(index(input.get(i)), i)), i);
+        });
+
+        return result;
+    }
+
+    template <unsigned N, typename Vec>
+    __aie_inline
+    vector<OffsetType, N> fetch(const Vec &input)
+    {
+        return fetch<Vec, N>(input);
+    }
+
+private:
+    // Same out-of-range policies as on AIE-ML: signed indices are biased and then saturated to [0, LUT_elems) or
+    // wrapped, and unsigned indices are saturated or wrapped directly
+    __aie_inline
+    unsigned index(T x) const
+    {
+        if constexpr (std::is_signed_v<T>) {
+            const int idx = int(x >> step_bits_) + int(bias_);
+
+            if constexpr (oor_policy == lut_oor_policy::truncate)
+                return unsigned(idx) & idx_max_;
+            else
+                return unsigned(std::min(std::max(idx, 0), int(idx_max_)));
+        }
+        else {
+            const unsigned idx = unsigned(x) >> step_bits_;
+
+            if constexpr (oor_policy == lut_oor_policy::truncate)
+                return idx & idx_max_;
+            else
+                return std::min(idx, idx_max_);
+        }
+    }
+
+    lut_gather<ParallelAccesses, storage_type, 1> gather_;
+    unsigned step_bits_;
+    unsigned bias_;
+    unsigned idx_max_;
+};
+
+}
+
+#endif
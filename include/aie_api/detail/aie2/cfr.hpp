@@ -0,0 +1,117 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2022 Xilinx, Inc.
+// Copyright (C) 2022-2026 Advanced Micro Devices, Inc.
+
+#pragma once
+
+#ifndef __AIE_API_DETAIL_AIE2_CFR__HPP__
+#define __AIE_API_DETAIL_AIE2_CFR__HPP__
+
+#include "../ld_st.hpp"
+#include "../mul.hpp"
+#include "../shuffle.hpp"
+
+namespace aie::detail {
+
+// AIE-ML has no CFR instructions. Each stage selects the window of the cancellation pulse that starts at sample cid,
+// with cid < 16, of the two consecutive blocks read at the offset given by the control word, and scales it by the peak
+// with a regular vector by scalar multiplication.
+template <>
+struct cfr<cint16> : cfr_peak_search<cint16>
+{
+    using accum_tag = accum_tag_for_type<cint16, 64>;
+    using acc_type = accum<accum_tag, 8>;
+
+    struct input_data
+    {
+        vector<cint16, 8> inA;
+        vector<cint16, 8> inB;
+        int cid;
+    };
+
+    template <typename Func>
+    class stage_iterator
+    {
+    public:
+        using        value_type = input_data;
+        using         reference = value_type;
+        using iterator_category = std::input_iterator_tag;
+        using   difference_type = ptrdiff_t;
+
+        stage_iterator(const cint16 * inpA, const cint16 * inpB, Func&& f, unsigned ctrl_upshift) :
+            ptrA_(inpA),
+            ptrB_(inpB),
+            cid_(0),
+            get_ctrl_(f),
+            ctrl_upshift_(ctrl_upshift)
+        {
+        }
+
+        stage_iterator &operator++()
+        {
+            // The control word holds the selection of the pulse in its 5 LSBs and the byte offset of the blocks in the
+            // remaining bits, like on AIE. The window is rotated out of the 16 samples of the two blocks, so only
+            // selections up to 15 are supported.
+            const int ctrl = get_ctrl_();
+            const int idx  = (ctrl >> 5) << ctrl_upshift_;
+
+            cid_ = ctrl & 0x1f;
+            REQUIRES_MSG(cid_ < 16, "Pulse selection must be less than 16");
+            ptrA_ret_ = (const cint16 *)((const char *)ptrA_ + idx);
+            ptrB_ret_ = (const cint16 *)((const char *)ptrB_ + idx);
+            return *this;
+        }
+
+        stage_iterator  operator++(int)
+        {
+            const stage_iterator it = *this;
+            ++(*this);
+            return it;
+        }
+
+        reference operator*() const
+        {
+            return { load_vector<8>(ptrA_ret_), load_vector<8>(ptrB_ret_), cid_ };
+        }
+
+    private:
+        const cint16 * ptrA_;
+        const cint16 * ptrB_;
+        const cint16 * ptrA_ret_;
+        const cint16 * ptrB_ret_;
+        int cid_;
+        Func get_ctrl_;
+        unsigned ctrl_upshift_;
+    };
+
+    template <typename Func>
+    auto begin(cint16 * inA, cint16 * inB, Func&& get_ctrl_function, unsigned ctrl_upshift = 0)
+    {
+        return stage_iterator<Func>(inA, inB, get_ctrl_function, ctrl_upshift);
+    }
+
+    template <unsigned Elems>
+    acc_type mul(const input_data &data, vector_elem_ref<cint16, Elems> elem)
+    {
+        return detail::mul<MulMacroOp::Mul, 64, cint16, cint16>::run(pulse(data), true, vector_elem_const_ref(elem), true);
+    }
+
+    template <unsigned Elems>
+    acc_type mac(acc_type acc, const input_data &data, vector_elem_ref<cint16, Elems> elem)
+    {
+        return detail::mul<MulMacroOp::Add_Mul, 64, cint16, cint16>::run(pulse(data), true, vector_elem_const_ref(elem), true, acc);
+    }
+
+private:
+    __aie_inline
+    static vector<cint16, 8> pulse(const input_data &data)
+    {
+        const vector<cint16, 16> blocks = concat_vector(data.inA, data.inB);
+
+        return shuffle_down_rotate<cint16, 16>::run(blocks, data.cid).template extract<8>(0);
+    }
+};
+
+}
+
+#endif
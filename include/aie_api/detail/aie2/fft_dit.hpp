@@ -20,14 +20,16 @@ namespace aie::detail {
     {
         static constexpr unsigned radix = 2;
 
+        template <typename Epilogue = fft_identity_epilogue<Output>>
         __aie_inline
         static void run(const Input * __restrict x,
                         const Twiddle * __restrict tw0,
-                        unsigned n, unsigned shift_tw, unsigned shift, bool inv, Output * __restrict out)
+                        unsigned n, unsigned shift_tw, unsigned shift, bool inv,
+                        fft_epilogue_output_t<Epilogue> * __restrict out, Epilogue &&epilogue = {})
         {
             constexpr unsigned stage = fft_get_stage<Input, Output, Twiddle>(radix, Vectorization);
             using FFT = fft_dit<Vectorization, stage, radix, Input, Output, Twiddle>;
-            using iterator = restrict_vector_iterator<Output, FFT::out_vector_size, 1, aie_dm_resource::none>;
+            using iterator = restrict_vector_iterator<fft_epilogue_output_t<Epilogue>, FFT::out_vector_size, 1, aie_dm_resource::none>;
 
             FFT fft(shift_tw, shift, inv);
 
@@ -42,8 +44,8 @@ namespace aie::detail {
                 chess_loop_range(1,)
             {
                 const auto out = fft.dit(*it_stage++);
-                *it_out0++ = out[0];
-                *it_out1++ = out[1];
+                *it_out0++ = epilogue(out[0]);
+                *it_out1++ = epilogue(out[1]);
             }
         }
     };
@@ -55,15 +57,17 @@ namespace aie::detail {
         static constexpr unsigned radix = 3;
         static constexpr unsigned one_third_Q15 = 10923;
 
+        template <typename Epilogue = fft_identity_epilogue<Output>>
         __aie_inline
         static void run(const Input * __restrict x,
                         const Twiddle * __restrict tw0,
                         const Twiddle * __restrict tw1,
-                        unsigned n, unsigned shift_tw, unsigned shift, bool inv, Output * __restrict out)
+                        unsigned n, unsigned shift_tw, unsigned shift, bool inv,
+                        fft_epilogue_output_t<Epilogue> * __restrict out, Epilogue &&epilogue = {})
         {
             constexpr unsigned stage = fft_get_stage<Input, Output, Twiddle>(radix, Vectorization);
             using FFT = fft_dit<Vectorization, stage, radix, Input, Output, Twiddle>;
-            using iterator = restrict_vector_iterator<Output, FFT::out_vector_size, 1, aie_dm_resource::none>;
+            using iterator = restrict_vector_iterator<fft_epilogue_output_t<Epilogue>, FFT::out_vector_size, 1, aie_dm_resource::none>;
 
             FFT fft(shift_tw, shift, inv);
 
@@ -78,9 +82,9 @@ namespace aie::detail {
                 chess_loop_range(1,)
             {
                 const auto out = fft.dit(*it_stage++);
-                *it_out = out[0]; it_out +=    block_size;
-                *it_out = out[1]; it_out +=    block_size;
-                *it_out = out[2]; it_out += -2*block_size + 1;
+                *it_out = epilogue(out[0]); it_out +=    block_size;
+                *it_out = epilogue(out[1]); it_out +=    block_size;
+                *it_out = epilogue(out[2]); it_out += -2*block_size + 1;
             }
 #else
             auto it_out0  = iterator(out);
@@ -92,9 +96,9 @@ namespace aie::detail {
                 chess_loop_range(1,)
             {
                 const auto out = fft.dit(*it_stage++);
-                *it_out0++ = out[0];
-                *it_out1++ = out[1];
-                *it_out2++ = out[2];
+                *it_out0++ = epilogue(out[0]);
+                *it_out1++ = epilogue(out[1]);
+                *it_out2++ = epilogue(out[2]);
             }
 #endif
         }
@@ -105,16 +109,18 @@ namespace aie::detail {
     {
         static constexpr unsigned radix = 4;
 
+        template <typename Epilogue = fft_identity_epilogue<Output>>
         __aie_inline
         static void run(const Input * __restrict x,
                         const Twiddle * __restrict tw0,
                         const Twiddle * __restrict tw1,
                         const Twiddle * __restrict tw2,
-                        unsigned n, unsigned shift_tw, unsigned shift, bool inv, Output * __restrict out)
+                        unsigned n, unsigned shift_tw, unsigned shift, bool inv,
+                        fft_epilogue_output_t<Epilogue> * __restrict out, Epilogue &&epilogue = {})
         {
             constexpr unsigned stage = fft_get_stage<Input, Output, Twiddle>(radix, Vectorization);
             using FFT = fft_dit<Vectorization, stage, radix, Input, Output, Twiddle>;
-            using iterator = restrict_vector_iterator<Output, FFT::out_vector_size, 1, aie_dm_resource::none>;
+            using iterator = restrict_vector_iterator<fft_epilogue_output_t<Epilogue>, FFT::out_vector_size, 1, aie_dm_resource::none>;
 
             FFT fft(shift_tw, shift, inv);
 
@@ -128,10 +134,10 @@ namespace aie::detail {
                 chess_loop_range(1,)
             {
                 const auto out = fft.dit(*it_stage++);
-                *it_out = out[0]; it_out +=    block_size;
-                *it_out = out[1]; it_out +=    block_size;
-                *it_out = out[2]; it_out +=    block_size;
-                *it_out = out[3]; it_out += -3*block_size + 1;
+                *it_out = epilogue(out[0]); it_out +=    block_size;
+                *it_out = epilogue(out[1]); it_out +=    block_size;
+                *it_out = epilogue(out[2]); it_out +=    block_size;
+                *it_out = epilogue(out[3]); it_out += -3*block_size + 1;
             }
         }
     };
@@ -141,17 +147,19 @@ namespace aie::detail {
     {
         static constexpr unsigned radix = 5;
 
+        template <typename Epilogue = fft_identity_epilogue<Output>>
         __aie_inline
         static void run(const Input * __restrict x,
                         const Twiddle * __restrict tw0,
                         const Twiddle * __restrict tw1,
                         const Twiddle * __restrict tw2,
                         const Twiddle * __restrict tw3,
-                        unsigned n, unsigned shift_tw, unsigned shift, bool inv, Output * __restrict out)
+                        unsigned n, unsigned shift_tw, unsigned shift, bool inv,
+                        fft_epilogue_output_t<Epilogue> * __restrict out, Epilogue &&epilogue = {})
         {
             constexpr unsigned stage = fft_get_stage<Input, Output, Twiddle>(radix, Vectorization);
             using FFT = fft_dit<Vectorization, stage, radix, Input, Output, Twiddle>;
-            using iterator = restrict_vector_iterator<Output, FFT::out_vector_size, 1, aie_dm_resource::none>;
+            using iterator = restrict_vector_iterator<fft_epilogue_output_t<Epilogue>, FFT::out_vector_size, 1, aie_dm_resource::none>;
 
             FFT fft(shift_tw, shift, inv);
 
@@ -165,11 +173,11 @@ namespace aie::detail {
                 chess_loop_range(1,)
             {
                 const auto out = fft.dit(*it_stage++);
-                *it_out = out[0]; it_out +=    block_size;
-                *it_out = out[1]; it_out +=    block_size;
-                *it_out = out[2]; it_out +=    block_size;
-                *it_out = out[3]; it_out +=    block_size;
-                *it_out = out[4]; it_out += -4*block_size + 1;
+                *it_out = epilogue(out[0]); it_out +=    block_size;
+                *it_out = epilogue(out[1]); it_out +=    block_size;
+                *it_out = epilogue(out[2]); it_out +=    block_size;
+                *it_out = epilogue(out[3]); it_out +=    block_size;
+                *it_out = epilogue(out[4]); it_out += -4*block_size + 1;
             }
         }
     };
@@ -7,6 +7,8 @@
 #ifndef __AIE_API_DETAIL_AIE2_LOCK__HPP__
 #define __AIE_API_DETAIL_AIE2_LOCK__HPP__
 
+#include <array>
+
 namespace aie::detail {
 
 class mutex {
@@ -38,15 +40,17 @@ public:
     }
 };
 
+// Producers keep one pair of locks per reader. A single pair shared by several readers would let a fast reader take the
+// tokens released for a slower one and run ahead into a buffer that has not been written yet.
 template <unsigned Readers, unsigned Writers>
-class producer_sem;
-
-template <>
-class producer_sem<1, 1>
+class producer_sem
 {
 private:
-    const unsigned lock_read_id_;
-    const unsigned lock_write_id_;
+    static_assert(Readers > 0);
+    static_assert(Writers > 0);
+
+    const std::array<unsigned, Readers> lock_read_ids_;
+    const std::array<unsigned, Readers> lock_write_ids_;
 
     producer_sem()                                = delete;
     producer_sem(const producer_sem &)            = delete;
@@ -58,29 +62,42 @@ private:
 public:
     void lock()
     {
-        ::acquire_greater_equal(lock_write_id_, 1);
+        utils::unroll_times<Readers>([&](unsigned r) __aie_inline {
+            ::acquire_greater_equal(lock_write_ids_[r], 1);
+        });
     }
 
     void unlock()
     {
-        ::release(lock_read_id_,  1);
+        utils::unroll_times<Readers>([&](unsigned r) __aie_inline {
+            ::release(lock_read_ids_[r],  1);
+        });
+    }
+
+    producer_sem(unsigned lock_read_id, unsigned lock_write_id) requires(Readers == 1) :
+        lock_read_ids_{lock_read_id},
+        lock_write_ids_{lock_write_id}
+    {
     }
 
-    producer_sem(unsigned lock_read_id, unsigned lock_write_id) :
-        lock_read_id_(lock_read_id),
-        lock_write_id_(lock_write_id)
+    producer_sem(const std::array<unsigned, Readers> &lock_read_ids,
+                 const std::array<unsigned, Readers> &lock_write_ids) :
+        lock_read_ids_(lock_read_ids),
+        lock_write_ids_(lock_write_ids)
     {
     }
 };
 
+// Consumers keep one pair of locks per writer, and a buffer is only available once all writers have released it
 template <unsigned Readers, unsigned Writers>
-class consumer_sem;
-
-template <>
-class consumer_sem<1, 1> {
+class consumer_sem
+{
 private:
-    const unsigned lock_read_id_;
-    const unsigned lock_write_id_;
+    static_assert(Readers > 0);
+    static_assert(Writers > 0);
+
+    const std::array<unsigned, Writers> lock_read_ids_;
+    const std::array<unsigned, Writers> lock_write_ids_;
 
     consumer_sem()                                = delete;
     consumer_sem(const consumer_sem &)            = delete;
@@ -92,17 +109,28 @@ private:
 public:
     void lock()
     {
-        ::acquire_greater_equal(lock_read_id_,  1);
+        utils::unroll_times<Writers>([&](unsigned w) __aie_inline {
+            ::acquire_greater_equal(lock_read_ids_[w],  1);
+        });
     }
 
     void unlock()
     {
-        ::release(lock_write_id_, 1);
+        utils::unroll_times<Writers>([&](unsigned w) __aie_inline {
+            ::release(lock_write_ids_[w], 1);
+        });
+    }
+
+    consumer_sem(unsigned lock_read_id, unsigned lock_write_id) requires(Writers == 1) :
+        lock_read_ids_{lock_read_id},
+        lock_write_ids_{lock_write_id}
+    {
     }
 
-    consumer_sem(unsigned lock_read_id, unsigned lock_write_id) :
-        lock_read_id_(lock_read_id),
-        lock_write_id_(lock_write_id)
+    consumer_sem(const std::array<unsigned, Writers> &lock_read_ids,
+                 const std::array<unsigned, Writers> &lock_write_ids) :
+        lock_read_ids_(lock_read_ids),
+        lock_write_ids_(lock_write_ids)
     {
     }
 };
@@ -7,11 +7,43 @@
 #ifndef __AIE_API_DETAIL_CFR_HPP__
 #define __AIE_API_DETAIL_CFR_HPP__
 
+#include "abs_square.hpp"
+#include "compare.hpp"
+#include "max_min.hpp"
+
 namespace aie::detail {
 
 template <typename T>
 struct cfr;
 
+// Peak search shared by all architectures. The magnitudes are computed with abs_square and the peak is found with a max
+// reduction and a comparison, so no scalar loop over the samples is needed.
+template <typename T>
+struct cfr_peak_search
+{
+    struct peak_data
+    {
+        unsigned index;
+        int32    magnitude;
+        T        value;
+    };
+
+    // Returns the sample with the largest squared magnitude. If several samples share it, the last one is returned.
+    // The magnitudes are rounded to int32 from the accumulator. With shift = 0, the only sample whose magnitude does
+    // not fit is -32768-32768j (2^31), which saturates to 2^31 - 1 when saturation is enabled and wraps otherwise.
+    // shift = 1 avoids the overflow.
+    template <unsigned Elems>
+    __aie_inline
+    static peak_data find_peak(const vector<T, Elems> &v, int shift = 0)
+    {
+        const vector<int32, Elems> mag = abs_square<T, int32, Elems>::run(v, shift);
+        const int32                max = max_reduce<int32, Elems>::run(mag);
+        const unsigned             idx = Elems - 1 - eq<int32, Elems>::run(mag, max).clz();
+
+        return { idx, max, v.get(idx) };
+    }
+};
+
 }
 
 #if __AIE_ARCH__ == 10
@@ -20,7 +52,7 @@ struct cfr;
 
 #elif __AIE_ARCH__ == 20 || __AIE_ARCH__ == 21 || __AIE_ARCH__ == 22
 
-// TODO: implement CFR support on AIE2
+#include "aie2/cfr.hpp"
 
 #endif
 
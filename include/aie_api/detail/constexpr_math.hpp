@@ -0,0 +1,258 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2022 Xilinx, Inc.
+// Copyright (C) 2022-2026 Advanced Micro Devices, Inc.
+
+#pragma once
+
+#ifndef __AIE_API_DETAIL_CONSTEXPR_MATH__HPP__
+#define __AIE_API_DETAIL_CONSTEXPR_MATH__HPP__
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+/*
+ * Double-precision math helpers that can be evaluated at compile time. They are used to generate constant tables
+ * (twiddle factors, lookup tables, etc.) without depending on the target's math library, which is not constexpr.
+ */
+namespace aie::detail::constexpr_math {
+
+static constexpr double pi  = 3.14159265358979323846264338327950288;
+static constexpr double ln2 = 0.69314718055994530941723212145817657;
+
+/*
+ * Taylor expansions, only accurate for |x| <= pi / 4
+ */
+constexpr double sin_kernel(double x)
+{
+    const double x2 = x * x;
+    double term = x;
+    double ret  = x;
+
+    for (unsigned i = 1; i <= 10; ++i) {
+        term *= -x2 / double((2 * i) * (2 * i + 1));
+        ret  += term;
+    }
+
+    return ret;
+}
+
+constexpr double cos_kernel(double x)
+{
+    const double x2 = x * x;
+    double term = 1.0;
+    double ret  = 1.0;
+
+    for (unsigned i = 1; i <= 10; ++i) {
+        term *= -x2 / double((2 * i - 1) * (2 * i));
+        ret  += term;
+    }
+
+    return ret;
+}
+
+/*
+ * Returns (cos(2 * pi * num / den), sin(2 * pi * num / den)). The angle is reduced with integer arithmetic, so the
+ * result is exact at multiples of pi / 4 and does not lose precision for large numerators.
+ */
+constexpr std::pair<double, double> cos_sin_turns(uint64_t num, uint64_t den)
+{
+    // Reduce to a quadrant and a remainder in [0, den)
+    const uint64_t k         = (num % den) * 4;
+    const unsigned quadrant  = unsigned(k / den);
+    const uint64_t remainder = k % den;
+
+    double c, s;
+
+    // Reduce to the first octant to keep the argument of the Taylor expansions within [0, pi / 4]
+    if (2 * remainder <= den) {
+        const double x = (pi / 2) * double(remainder) / double(den);
+        c = cos_kernel(x);
+        s = sin_kernel(x);
+    }
+    else {
+        const double x = (pi / 2) * double(den - remainder) / double(den);
+        c = sin_kernel(x);
+        s = cos_kernel(x);
+    }
+
+    switch (quadrant) {
+        case 0:  return { c,  s};
+        case 1:  return {-s,  c};
+        case 2:  return {-c, -s};
+        default: return { s, -c};
+    }
+}
+
+/*
+ * Returns the largest integral value not greater than x
+ */
+constexpr double floor(double x)
+{
+    const double t = double(int64_t(x));
+
+    return (t > x)? t - 1 : t;
+}
+
+/*
+ * Returns (cos(x), sin(x)). The argument is reduced to the first octant before evaluating the kernels.
+ */
+constexpr std::pair<double, double> cos_sin(double x)
+{
+    const double r = x - 2 * pi * floor(x / (2 * pi));
+
+    unsigned quadrant = unsigned(r / (pi / 2));
+    if (quadrant > 3)
+        quadrant = 3;
+
+    const double y = r - quadrant * (pi / 2);
+
+    double c, s;
+
+    if (y <= pi / 4) {
+        c = cos_kernel(y);
+        s = sin_kernel(y);
+    }
+    else {
+        c = sin_kernel(pi / 2 - y);
+        s = cos_kernel(pi / 2 - y);
+    }
+
+    switch (quadrant) {
+        case 0:  return { c,  s};
+        case 1:  return {-s,  c};
+        case 2:  return {-c, -s};
+        default: return { s, -c};
+    }
+}
+
+constexpr double sin(double x)
+{
+    return cos_sin(x).second;
+}
+
+constexpr double cos(double x)
+{
+    return cos_sin(x).first;
+}
+
+/*
+ * Rounds to the nearest integer, with ties away from zero
+ */
+constexpr double round(double x)
+{
+    return x >= 0? double(int64_t(x + 0.5)) : -double(int64_t(-x + 0.5));
+}
+
+/*
+ * Returns e^x. The argument is reduced to x = n * ln(2) + r with |r| <= ln(2) / 2 before evaluating the Taylor
+ * expansion.
+ */
+constexpr double exp(double x)
+{
+    if (x < -745.0)
+        return 0.0;
+    if (x > 709.0)
+        return std::numeric_limits<double>::infinity();
+
+    const double n = round(x / ln2);
+    const double r = x - n * ln2;
+
+    double term = 1.0;
+    double ret  = 1.0;
+
+    for (unsigned i = 1; i <= 20; ++i) {
+        term *= r / double(i);
+        ret  += term;
+    }
+
+    for (int64_t i = 0; i < int64_t(n); ++i)
+        ret *= 2.0;
+    for (int64_t i = 0; i < -int64_t(n); ++i)
+        ret *= 0.5;
+
+    return ret;
+}
+
+/*
+ * Returns the error function of x. The Taylor expansion is used for |x| < 3 and the continued fraction of erfc above.
+ */
+constexpr double erf(double x)
+{
+    const double a = x < 0? -x : x;
+    double ret;
+
+    if (a < 3.0) {
+        const double a2 = a * a;
+        double term = a;
+        double sum  = a;
+
+        for (unsigned n = 1; n <= 60; ++n) {
+            term *= -a2 / double(n);
+
+            const double next = term / double(2 * n + 1);
+            sum += next;
+
+            if ((next < 0? -next : next) < 1e-17 * sum)
+                break;
+        }
+
+        ret = 1.1283791670955125739 * sum;
+    }
+    else {
+        // erfc(a) = exp(-a^2) / sqrt(pi) / (a + 1/2 / (a + 1 / (a + 3/2 / (a + ...))))
+        double k = a;
+
+        for (unsigned n = 80; n > 0; --n)
+            k = a + (0.5 * double(n)) / k;
+
+        ret = 1.0 - exp(-a * a) / (1.7724538509055160273 * k);
+    }
+
+    return x < 0? -ret : ret;
+}
+
+/*
+ * Quantizes the given value to an integral type with round-to-nearest and saturation
+ */
+template <typename T> requires(std::is_integral_v<T>)
+constexpr T to_fixed(double x, unsigned shift = 0)
+{
+    const double scaled = round(x * double(uint64_t(1) << shift));
+
+    if (scaled >= double(std::numeric_limits<T>::max()))
+        return std::numeric_limits<T>::max();
+    if (scaled <= double(std::numeric_limits<T>::min()))
+        return std::numeric_limits<T>::min();
+
+    return T(int64_t(scaled));
+}
+
+/*
+ * Returns the bit pattern of the bfloat16 value nearest to x (round to nearest even)
+ */
+constexpr uint16_t to_bfloat16_bits(double x)
+{
+    const uint32_t bits = __builtin_bit_cast(uint32_t, float(x));
+
+    // NaN must not be rounded into infinity
+    if ((bits & 0x7fff'ffff) > 0x7f80'0000)
+        return uint16_t((bits >> 16) | 0x0040);
+
+    const uint32_t rounding = 0x7fff + ((bits >> 16) & 1);
+
+    return uint16_t((bits + rounding) >> 16);
+}
+
+/*
+ * Returns the value of the given bfloat16 bit pattern
+ */
+constexpr float from_bfloat16_bits(uint16_t bits)
+{
+    return __builtin_bit_cast(float, uint32_t(bits) << 16);
+}
+
+} // namespace aie::detail::constexpr_math
+
+#endif
@@ -42,6 +42,10 @@
  *
  * \note
  * Odd-radix FFT stages are only available for vectorization values greater than or equal to the underlying output vector sizes.
+ * They are not restricted to the first stage of a transform: an odd-radix stage may be placed at any position of the stage chain
+ * as long as its vectorization meets this requirement. Since every stage requires the point size to be a multiple of the radix
+ * times the output vector size, any supported mixed-radix point size (e.g. 12 * 2^k or 15 * 2^k points) can be computed by
+ * running all odd-radix stages first. For example, a 1536 point transform can be computed as r3, r2, r4, r4, r4, r4 on AIE-ML.
  *
  * <table>
  * <caption>Underlying output vector sizes</caption>
@@ -99,10 +103,10 @@ static constexpr unsigned fft_get_stage(unsigned Radix, unsigned Vectorization)
                 else if (Vectorization >= 4) { return 0; }
                 else                         { UNREACHABLE_MSG("Requested vectorization not supported for Radix 4\n"); }
             }
-            //Only plans to support stage 0 for odd radix at this time
+            // Odd radix stages are implemented for large vectorizations only, at any position in the stage chain
             else if (Radix == 3 || Radix == 5) {
                 if   (Vectorization >= 4) { return 0; }
-                else                      { UNREACHABLE_MSG("Only vectorization of 4 or greater is supported in Radix 3 and 5\n"); }
+                else                      { UNREACHABLE_MSG("Radix 3 and 5 stages require a vectorization of 4 or greater\n"); }
             }
         }
         else {
@@ -130,7 +134,7 @@ static constexpr unsigned fft_get_stage(unsigned Radix, unsigned Vectorization)
             }
             else if (Radix == 3 || Radix == 5) {
                 if   (Vectorization >= 2) { return 0; }
-                else                      { UNREACHABLE_MSG("Only vectorization of 2 or greater is supported in Radix 3 and 5\n"); }
+                else                      { UNREACHABLE_MSG("Radix 3 and 5 stages require a vectorization of 2 or greater\n"); }
             }
         }
         else {
@@ -150,7 +154,7 @@ static constexpr unsigned fft_get_stage(unsigned Radix, unsigned Vectorization)
             }
             else if (Radix == 3 || Radix == 5) {
                 if   (Vectorization >= 4) { return 0; }
-                else                      { UNREACHABLE_MSG("Only vectorization of 4 or greater is supported in Radix 3 and 5\n"); }
+                else                      { UNREACHABLE_MSG("Radix 3 and 5 stages require a vectorization of 4 or greater\n"); }
             }
         }
     }
@@ -196,7 +200,7 @@ static constexpr unsigned fft_get_stage(unsigned Radix, unsigned Vectorization)
         }
         else if (Radix == 3 || Radix == 5) {
             if   (Vectorization >= 8) { return 0; }
-            else                      { UNREACHABLE_MSG("Only vectorization of 8 or greater is supported in Radix 3 and 5\n"); }
+            else                      { UNREACHABLE_MSG("Radix 3 and 5 stages require a vectorization of 8 or greater\n"); }
         }
     }
     else if constexpr (utils::is_one_of_v<Twiddle, cbfloat16, cfloat>) {
@@ -213,7 +217,7 @@ static constexpr unsigned fft_get_stage(unsigned Radix, unsigned Vectorization)
         }
         else if (Radix == 3 || Radix == 5) {
             if   (Vectorization >= 8) { return 0; }
-            else                      { UNREACHABLE_MSG("Only vectorization of 16 or greater is supported in Radix 3 and 5\n"); }
+            else                      { UNREACHABLE_MSG("Radix 3 and 5 stages require a vectorization of 8 or greater\n"); }
         }
     }
 
@@ -247,7 +251,7 @@ static constexpr unsigned fft_get_stage(unsigned Radix, unsigned Vectorization)
             }
             else if (Radix == 3 || Radix == 5) {
                 if   (Vectorization >= 16) { return 0; }
-                else                       { UNREACHABLE_MSG("Only vectorization of 16 or greater is supported in Radix 3 and 5\n"); }
+                else                       { UNREACHABLE_MSG("Radix 3 and 5 stages require a vectorization of 16 or greater\n"); }
             }
     }
     else if constexpr (utils::is_one_of_v<Twiddle, cbfloat16, cfloat>) {
@@ -265,7 +269,7 @@ static constexpr unsigned fft_get_stage(unsigned Radix, unsigned Vectorization)
         }
         else if (Radix == 3 || Radix == 5) {
             if   (Vectorization >= 16) { return 0; }
-            else                       { UNREACHABLE_MSG("Only vectorization of 16 or greater is supported in Radix 3 and 5\n"); }
+            else                       { UNREACHABLE_MSG("Radix 3 and 5 stages require a vectorization of 16 or greater\n"); }
         }
     }
 
@@ -441,6 +445,30 @@ struct is_valid_fft_op
 template <unsigned Radix, typename Input, typename Output, typename Twiddle>
 static constexpr bool is_valid_fft_op_v = is_valid_fft_op<Radix, Input, Output, Twiddle>::value();
 
+/*
+ * Epilogues are applied to each output vector of a stage right before it is stored. They take vectors of input_type
+ * and return vectors of output_type with the same number of elements, which is the type written to memory.
+ */
+template <typename T>
+struct fft_identity_epilogue
+{
+    using input_type  = T;
+    using output_type = T;
+
+    template <unsigned Elems>
+    __aie_inline
+    constexpr vector<T, Elems> operator()(const vector<T, Elems> &v) const
+    {
+        return v;
+    }
+};
+
+template <typename Epilogue>
+using fft_epilogue_input_t = typename std::remove_cvref_t<Epilogue>::input_type;
+
+template <typename Epilogue>
+using fft_epilogue_output_t = typename std::remove_cvref_t<Epilogue>::output_type;
+
 template <unsigned Radix, unsigned Vectorization, typename Input, typename Output, typename Twiddle>
 struct fft_dit_stage;
 
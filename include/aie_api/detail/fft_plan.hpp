@@ -0,0 +1,419 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2022 Xilinx, Inc.
+// Copyright (C) 2022-2026 Advanced Micro Devices, Inc.
+
+#pragma once
+
+#ifndef __AIE_API_DETAIL_FFT_PLAN_HPP__
+#define __AIE_API_DETAIL_FFT_PLAN_HPP__
+
+#include <array>
+#include <type_traits>
+#include <utility>
+
+#include "constexpr_math.hpp"
+#include "fft.hpp"
+#include "ld_st.hpp"
+#include "utils.hpp"
+
+namespace aie::detail {
+
+// Mirrors fft_get_stage, but returns whether an implementation exists instead of failing to compile
+#if __AIE_ARCH__ == 10
+
+template <typename Input, typename Output, typename Twiddle>
+static constexpr bool fft_has_stage_impl(unsigned Radix, unsigned Vectorization)
+{
+    const unsigned out_vector_size = fft_get_out_vector_size<Input, Output, Twiddle>(Radix, Vectorization);
+    const bool     stage0          = Vectorization >= out_vector_size && (Vectorization % out_vector_size) == 0;
+
+    if      constexpr (std::is_same_v<Twiddle, cint16>) {
+        if constexpr (std::is_same_v<Input, Output>) {
+            if      (Radix == 2 && std::is_same_v<Input, cint16>) { return Vectorization == 1 || Vectorization == 2 || Vectorization == 4 || stage0; }
+            else if (Radix == 2 && std::is_same_v<Input, cint32>) { return Vectorization == 1 || Vectorization == 2 || stage0; }
+            else if (Radix == 4)                                  { return Vectorization == 1 || stage0; }
+            else                                                  { return stage0; }
+        }
+        else {
+            return (Vectorization == 1 && (Radix == 2 || Radix == 4)) || stage0;
+        }
+    }
+    else if constexpr (std::is_same_v<Twiddle, cint32>) {
+        if constexpr (std::is_same_v<Input, Output>) {
+            if      (Radix == 2 && std::is_same_v<Input, cint16>) { return Vectorization == 1; }
+            else if (Radix == 2 && std::is_same_v<Input, cint32>) { return Vectorization == 1 || stage0; }
+            else if (Radix == 4)                                  { return Vectorization == 1 || (Vectorization >= 4 && stage0); }
+            else                                                  { return stage0; }
+        }
+        else {
+            return (Vectorization == 1 && (Radix == 2 || Radix == 4)) || stage0;
+        }
+    }
+    else if constexpr (std::is_same_v<Twiddle, cfloat>) {
+        if (Radix == 2) { return Vectorization == 1 || Vectorization == 2 || stage0; }
+        else            { return stage0; }
+    }
+
+    return false;
+}
+
+#elif __AIE_ARCH__ == 20
+
+template <typename Input, typename Output, typename Twiddle>
+static constexpr bool fft_has_stage_impl(unsigned Radix, unsigned Vectorization)
+{
+    const unsigned out_vector_size = fft_get_out_vector_size<Input, Output, Twiddle>(Radix, Vectorization);
+    const bool     stage0          = Vectorization >= out_vector_size && (Vectorization % out_vector_size) == 0;
+
+    if      (Radix == 2) { return Vectorization == 1 || Vectorization == 2 || Vectorization == 4 || stage0; }
+    else if (Radix == 4) { return Vectorization == 1 || Vectorization == 4 || stage0; }
+    else                 { return stage0; }
+}
+
+#else
+
+template <typename Input, typename Output, typename Twiddle>
+static constexpr bool fft_has_stage_impl(unsigned Radix, unsigned Vectorization)
+{
+    const unsigned out_vector_size = fft_get_out_vector_size<Input, Output, Twiddle>(Radix, Vectorization);
+    const bool     stage0          = Vectorization >= out_vector_size && (Vectorization % out_vector_size) == 0;
+
+    if      (Radix == 2) { return Vectorization == 1 || Vectorization == 2 || Vectorization == 4 || Vectorization == 8 || stage0; }
+    else if (Radix == 4) { return Vectorization == 1 || Vectorization == 4 || stage0; }
+    else                 { return stage0; }
+}
+
+#endif
+
+template <typename Input, typename Output, typename Twiddle>
+static constexpr bool fft_is_valid_op(unsigned Radix)
+{
+    switch (Radix) {
+    case 2:  return is_valid_fft_op_v<2, Input, Output, Twiddle>;
+    case 3:  return is_valid_fft_op_v<3, Input, Output, Twiddle>;
+    case 4:  return is_valid_fft_op_v<4, Input, Output, Twiddle>;
+    case 5:  return is_valid_fft_op_v<5, Input, Output, Twiddle>;
+    default: return false;
+    }
+}
+
+/*
+ * Says whether fft_dit_stage<Radix, Vectorization, Input, Output, Twiddle> is implemented and can compute an n-point
+ * transform
+ */
+template <typename Input, typename Output, typename Twiddle>
+static constexpr bool fft_has_stage(unsigned Radix, unsigned Vectorization, unsigned n)
+{
+    if (!fft_is_valid_op<Input, Output, Twiddle>(Radix))
+        return false;
+
+    if (!fft_has_stage_impl<Input, Output, Twiddle>(Radix, Vectorization))
+        return false;
+
+    return (n % (Radix * fft_get_out_vector_size<Input, Output, Twiddle>(Radix, Vectorization))) == 0;
+}
+
+template <typename Twiddle> struct fft_twiddle_storage;
+
+template <> struct fft_twiddle_storage<cint16>    { using type = int16_t;  static constexpr unsigned default_shift = 15; };
+template <> struct fft_twiddle_storage<cint32>    { using type = int32_t;  static constexpr unsigned default_shift = 31; };
+template <> struct fft_twiddle_storage<cfloat>    { using type = float;    static constexpr unsigned default_shift = 0;  };
+// bfloat16 is not a literal type on all targets, so its bit pattern is stored instead
+template <> struct fft_twiddle_storage<cbfloat16> { using type = uint16_t; static constexpr unsigned default_shift = 0;  };
+
+template <typename Twiddle>
+static constexpr unsigned fft_default_twiddle_shift_v = fft_twiddle_storage<Twiddle>::default_shift;
+
+template <typename Twiddle>
+static constexpr auto fft_twiddle_component(double v, unsigned shift_tw)
+{
+    using T = typename fft_twiddle_storage<Twiddle>::type;
+
+    if      constexpr (std::is_same_v<Twiddle, cbfloat16>) return constexpr_math::to_bfloat16_bits(v);
+    else if constexpr (std::is_floating_point_v<T>)        return T(v);
+    else                                                    return constexpr_math::to_fixed<T>(v, shift_tw);
+}
+
+/*
+ * Chooses the sequence of stages used by fft_plan. Among all the decompositions of the point size into the radices and
+ * vectorizations for which a stage implementation exists, it picks one with the minimum number of stages (and thus
+ * passes over the data).
+ */
+template <typename Input, typename Output, typename Twiddle>
+struct fft_planner
+{
+    // Intermediate results are kept in the widest of the input and output types to avoid losing precision
+    using intermediate_type = std::conditional_t<(type_bits_v<Output> > type_bits_v<Input>), Output, Input>;
+
+    static constexpr unsigned invalid = ~0u;
+
+    // Preferred order when several radices lead to the same number of stages. Odd radices are only implemented for
+    // large vectorizations, so they are placed at the beginning of the transform. This always succeeds for supported
+    // point sizes: n must be a multiple of radix * out_vector_size, so the power-of-two factor of n left for the later
+    // stages is a multiple of the output vector size. A single radix 2 stage is also placed at the beginning, as the
+    // remaining radix 4 stages then hit the dedicated small vectorization kernels.
+    static constexpr std::array<unsigned, 4> candidate_radices = {5, 3, 2, 4};
+
+    // Stage that consumes `points` (the product of its radix and the radices of all later stages) samples per
+    // butterfly group
+    static constexpr bool is_supported_stage(unsigned n, unsigned radix, unsigned points)
+    {
+        const unsigned vectorization = points / radix;
+        const bool first = points == n;
+        const bool last  = vectorization == 1;
+
+        if      (first && last) return fft_has_stage<Input,             Output,            Twiddle>(radix, vectorization, n);
+        else if (first)         return fft_has_stage<Input,             intermediate_type, Twiddle>(radix, vectorization, n);
+        else if (last)          return fft_has_stage<intermediate_type, Output,            Twiddle>(radix, vectorization, n);
+        else                    return fft_has_stage<intermediate_type, intermediate_type, Twiddle>(radix, vectorization, n);
+    }
+
+    static constexpr unsigned count_stages(unsigned n, unsigned points)
+    {
+        if (points == 1)
+            return 0;
+
+        unsigned ret = invalid;
+
+        for (unsigned radix : candidate_radices) {
+            if ((points % radix) != 0 || !is_supported_stage(n, radix, points))
+                continue;
+
+            const unsigned rest = count_stages(n, points / radix);
+
+            if (rest != invalid && rest + 1 < ret)
+                ret = rest + 1;
+        }
+
+        return ret;
+    }
+
+    template <size_t NumStages>
+    static constexpr std::array<unsigned, NumStages> radices(unsigned n)
+    {
+        std::array<unsigned, NumStages> ret{};
+        unsigned points = n;
+
+        for (unsigned s = 0; s < NumStages; ++s) {
+            for (unsigned radix : candidate_radices) {
+                if ((points % radix) == 0 && is_supported_stage(n, radix, points) &&
+                    count_stages(n, points / radix) == NumStages - s - 1) {
+                    ret[s] = radix;
+                    break;
+                }
+            }
+
+            points /= ret[s];
+        }
+
+        return ret;
+    }
+
+    template <size_t NumStages>
+    static constexpr std::array<unsigned, NumStages> vectorizations(unsigned n, const std::array<unsigned, NumStages> &radices)
+    {
+        std::array<unsigned, NumStages> ret{};
+        unsigned points = n;
+
+        for (unsigned s = 0; s < NumStages; ++s) {
+            points /= radices[s];
+            ret[s] = points;
+        }
+
+        return ret;
+    }
+
+    // Twiddle tables of a stage are stored back to back, each of them padded to keep every table aligned
+    static constexpr unsigned table_align = std::max<unsigned>(vector_decl_align / sizeof(Twiddle), 1);
+
+    static constexpr unsigned table_stride(unsigned n, unsigned radix, unsigned vectorization)
+    {
+        return utils::ceildiv(n / vectorization / radix, table_align) * table_align;
+    }
+
+    template <size_t NumStages>
+    static constexpr std::array<unsigned, NumStages + 1> twiddle_offsets(unsigned n,
+                                                                         const std::array<unsigned, NumStages> &radices,
+                                                                         const std::array<unsigned, NumStages> &vectorizations)
+    {
+        std::array<unsigned, NumStages + 1> ret{};
+
+        for (unsigned s = 0; s < NumStages; ++s)
+            ret[s + 1] = ret[s] + (radices[s] - 1) * table_stride(n, radices[s], vectorizations[s]);
+
+        return ret;
+    }
+
+    // Rotation rate of the given twiddle table. Radix 4 stages expect w(tw1) < w(tw0) < w(tw2)
+    static constexpr unsigned twiddle_rate(unsigned radix, unsigned table)
+    {
+        if (radix == 4)
+            return table == 0? 2 : (table == 1? 1 : 3);
+
+        return table + 1;
+    }
+
+    template <size_t Size, size_t NumStages>
+    static constexpr auto make_twiddles(unsigned n,
+                                        const std::array<unsigned, NumStages> &radices,
+                                        const std::array<unsigned, NumStages> &vectorizations,
+                                        const std::array<unsigned, NumStages + 1> &offsets,
+                                        unsigned shift_tw)
+    {
+        std::array<typename fft_twiddle_storage<Twiddle>::type, Size> ret{};
+
+        for (unsigned s = 0; s < NumStages; ++s) {
+            const unsigned n_stage = n / vectorizations[s];
+            const unsigned n_tws   = n_stage / radices[s];
+            const unsigned stride  = table_stride(n, radices[s], vectorizations[s]);
+
+            for (unsigned t = 0; t < radices[s] - 1; ++t) {
+                const unsigned r = twiddle_rate(radices[s], t);
+
+                for (unsigned i = 0; i < n_tws; ++i) {
+                    const auto [c, sn] = constexpr_math::cos_sin_turns(r * i, n_stage);
+                    const unsigned idx = offsets[s] + t * stride + i;
+
+                    ret[2 * idx]     = fft_twiddle_component<Twiddle>( c,  shift_tw);
+                    ret[2 * idx + 1] = fft_twiddle_component<Twiddle>(-sn, shift_tw);
+                }
+            }
+        }
+
+        return ret;
+    }
+};
+
+template <unsigned N, typename Input, typename Output, typename Twiddle, unsigned TwiddleShift>
+struct fft_plan
+{
+    using planner           = fft_planner<Input, Output, Twiddle>;
+    using intermediate_type = typename planner::intermediate_type;
+
+    static constexpr unsigned planned_stages = planner::count_stages(N, N);
+
+    static_assert(N > 1, "FFT point size must be larger than 1");
+    static_assert(planned_stages != planner::invalid, "No combination of the available FFT stages implements the requested point size");
+
+    static constexpr unsigned num_stages = planned_stages == planner::invalid? 0 : planned_stages;
+
+    static constexpr std::array<unsigned, num_stages> radices        = planner::template radices<num_stages>(N);
+    static constexpr std::array<unsigned, num_stages> vectorizations = planner::vectorizations(N, radices);
+
+    static constexpr std::array<unsigned, num_stages + 1> twiddle_offsets = planner::twiddle_offsets(N, radices, vectorizations);
+    static constexpr unsigned                             num_twiddles    = twiddle_offsets[num_stages];
+
+    alignas(vector_decl_align)
+    static constexpr auto twiddle_data = planner::template make_twiddles<2 * num_twiddles>(N, radices, vectorizations,
+                                                                                            twiddle_offsets, TwiddleShift);
+
+    // The output buffer is used as one of the ping-pong buffers when it can hold intermediate results
+    static constexpr unsigned scratch_size = num_stages < 2?                                  0 :
+                                             std::is_same_v<intermediate_type, Output>? N : 2 * N;
+
+    template <unsigned Stage, unsigned Table>
+    static const Twiddle *twiddles()
+    {
+        return (const Twiddle *)twiddle_data.data() + twiddle_offsets[Stage]
+                                                    + Table * planner::table_stride(N, radices[Stage], vectorizations[Stage]);
+    }
+
+    template <unsigned Stage, typename T, typename U, typename... Epilogue>
+    __aie_inline
+    static void run_stage(const T *x, unsigned shift_tw, unsigned shift, bool inv, U *out, Epilogue &&... epilogue)
+    {
+        constexpr unsigned Radix         = radices[Stage];
+        constexpr unsigned Vectorization = vectorizations[Stage];
+
+        using stage = fft_dit_stage<Radix, Vectorization, T, U, Twiddle>;
+
+        if      constexpr (Radix == 2)
+            stage::run(x, twiddles<Stage, 0>(),
+                       N, shift_tw, shift, inv, out, std::forward<Epilogue>(epilogue)...);
+        else if constexpr (Radix == 3)
+            stage::run(x, twiddles<Stage, 0>(), twiddles<Stage, 1>(),
+                       N, shift_tw, shift, inv, out, std::forward<Epilogue>(epilogue)...);
+        else if constexpr (Radix == 4)
+            stage::run(x, twiddles<Stage, 0>(), twiddles<Stage, 1>(), twiddles<Stage, 2>(),
+                       N, shift_tw, shift, inv, out, std::forward<Epilogue>(epilogue)...);
+        else if constexpr (Radix == 5)
+            stage::run(x, twiddles<Stage, 0>(), twiddles<Stage, 1>(), twiddles<Stage, 2>(), twiddles<Stage, 3>(),
+                       N, shift_tw, shift, inv, out, std::forward<Epilogue>(epilogue)...);
+    }
+
+    // Stages ping-pong between the scratch and output buffers so that the last one writes into the output buffer
+    template <unsigned Stage>
+    __aie_inline
+    static intermediate_type *stage_output(intermediate_type *tmp, Output *out)
+    {
+        constexpr unsigned remaining = num_stages - 1 - Stage;
+
+        if constexpr (std::is_same_v<intermediate_type, Output>)
+            return (remaining % 2)? tmp : out;
+        else
+            return (remaining % 2)? tmp : tmp + N;
+    }
+
+    template <unsigned Stage = 0, typename T>
+    __aie_inline
+    static void run(const T *x, unsigned shift_tw, unsigned shift, bool inv, intermediate_type *tmp, Output *out)
+    {
+        if constexpr (Stage + 1 == num_stages) {
+            run_stage<Stage>(x, shift_tw, shift, inv, out);
+        }
+        else {
+            intermediate_type *dst = stage_output<Stage>(tmp, out);
+
+            run_stage<Stage>(x, shift_tw, shift, inv, dst);
+            run<Stage + 1>((const intermediate_type *)dst, shift_tw, shift, inv, tmp, out);
+        }
+    }
+};
+
+/*
+ * Coefficients of the pass that splits the N / 2 point transform of the packed real samples into the first half of
+ * the N point spectrum:
+ *
+ *   X[k] = A[k] * Z[k] + B[k] * conj(Z[N / 2 - k]),  A[k] = (1 - j * W[k]) / 2,  B[k] = (1 + j * W[k]) / 2
+ *
+ * with W[k] = exp(-2j * pi * k / N). The N / 2 values of A are followed by the N / 2 values of B.
+ */
+template <typename Twiddle, size_t Size>
+static constexpr auto make_rfft_coefficients(unsigned n, unsigned shift_tw)
+{
+    std::array<typename fft_twiddle_storage<Twiddle>::type, Size> ret{};
+
+    const unsigned half = n / 2;
+
+    for (unsigned k = 0; k < half; ++k) {
+        const auto [c, s] = constexpr_math::cos_sin_turns(k, n);
+
+        ret[2 * k]              = fft_twiddle_component<Twiddle>((1 - s) / 2, shift_tw);
+        ret[2 * k + 1]          = fft_twiddle_component<Twiddle>(-c / 2,      shift_tw);
+        ret[2 * (half + k)]     = fft_twiddle_component<Twiddle>((1 + s) / 2, shift_tw);
+        ret[2 * (half + k) + 1] = fft_twiddle_component<Twiddle>( c / 2,      shift_tw);
+    }
+
+    return ret;
+}
+
+template <unsigned N, typename Twiddle, unsigned TwiddleShift>
+struct rfft_coefficients
+{
+    alignas(vector_decl_align)
+    static constexpr auto data = make_rfft_coefficients<Twiddle, 2 * N>(N, TwiddleShift);
+
+    static const Twiddle *a()
+    {
+        return (const Twiddle *)data.data();
+    }
+
+    static const Twiddle *b()
+    {
+        return (const Twiddle *)data.data() + N / 2;
+    }
+};
+
+} // namespace aie::detail
+
+#endif
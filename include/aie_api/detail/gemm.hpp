@@ -0,0 +1,92 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2022 Xilinx, Inc.
+// Copyright (C) 2022-2026 Advanced Micro Devices, Inc.
+
+#pragma once
+
+#ifndef __AIE_API_DETAIL_GEMM_HPP__
+#define __AIE_API_DETAIL_GEMM_HPP__
+
+#include <array>
+#include <type_traits>
+
+#include "utils.hpp"
+
+#include "../concepts.hpp"
+#include "../types.hpp"
+
+namespace aie::detail {
+
+// Bits in the accumulator register file that the grid of C tiles of a GEMM driver may occupy
+#if __AIE_ARCH__ == 10
+static constexpr unsigned gemm_accum_register_bits = 8 * 384;
+#else
+static constexpr unsigned gemm_accum_register_bits = 8 * 1024;
+#endif
+
+// Default mmul shape (M, K, N) used by the GEMM driver for each combination of input types. The shapes are taken from
+// the table of supported matrix multiplication modes, preferring the ones that map to a single native instruction.
+// A zero shape means that there is no default and the shape must be given explicitly.
+template <typename TypeA, typename TypeB>
+static constexpr std::array<unsigned, 3> gemm_default_shape()
+{
+    constexpr unsigned bits_a = type_bits_v<TypeA>;
+    constexpr unsigned bits_b = type_bits_v<TypeB>;
+
+    if constexpr (is_complex_v<TypeA> || is_complex_v<TypeB>) {
+        return {0, 0, 0};
+    }
+    else if constexpr (is_floating_point_v<TypeA> || is_floating_point_v<TypeB>) {
+#if __AIE_ARCH__ == 10
+        if constexpr (std::is_same_v<TypeA, float> && std::is_same_v<TypeB, float>) return {4, 2, 4};
+#else
+        if constexpr (std::is_same_v<TypeA, float>    && std::is_same_v<TypeB, float>)    return {4, 8, 4};
+#if __AIE_ARCH__ == 22
+        if constexpr (std::is_same_v<TypeA, bfloat16> && std::is_same_v<TypeB, bfloat16>) return {4, 8, 8};
+#else
+        if constexpr (std::is_same_v<TypeA, bfloat16> && std::is_same_v<TypeB, bfloat16>) return {4, 8, 4};
+#endif
+#endif
+        return {0, 0, 0};
+    }
+    else {
+#if __AIE_ARCH__ == 10
+        if constexpr (bits_a ==  8 && bits_b ==  8) return {4, 8, 4};
+        if constexpr (bits_a == 16 && bits_b ==  8) return {4, 4, 4};
+        if constexpr (bits_a ==  8 && bits_b == 16) return {4, 4, 8};
+        if constexpr (bits_a == 16 && bits_b == 16) return {4, 4, 4};
+#elif __AIE_ARCH__ == 20
+        if constexpr (bits_a ==  8 && bits_b ==  8) return {4, 8, 8};
+        if constexpr (bits_a == 16 && bits_b ==  8) return {4, 8, 4};
+        if constexpr (bits_a ==  8 && bits_b == 16) return {4, 4, 8};
+        if constexpr (bits_a == 16 && bits_b == 16) return {4, 4, 4};
+#else
+        if constexpr (bits_a ==  8 && bits_b ==  8) return {4, 8, 8};
+        if constexpr (bits_a == 16 && bits_b ==  8) return {4, 4, 8};
+        if constexpr (bits_a ==  8 && bits_b == 16) return {4, 4, 8};
+#endif
+        return {0, 0, 0};
+    }
+}
+
+// Shape (rows, columns) of the grid of C tiles that are accumulated at the same time. The grid is the largest one, up
+// to 4x4 tiles, whose accumulators fit in the register file. Each additional tile saves loads of A or B tiles, and
+// grids are kept as square as possible as a RxC grid needs R + C loads for R * C multiplications.
+static constexpr std::array<unsigned, 2> gemm_accum_grid(unsigned tile_bits)
+{
+    unsigned count = 1;
+    unsigned log2  = 0;
+
+    while (count < 16 && 2 * count * tile_bits <= gemm_accum_register_bits) {
+        count *= 2;
+        log2  += 1;
+    }
+
+    const unsigned rows = 1u << ((log2 + 1) / 2);
+
+    return {rows, count / rows};
+}
+
+} // namespace aie::detail
+
+#endif
@@ -14,9 +14,11 @@ struct linear_approx;
 
 }
 
-//TODO: Support for linear approx in AIE1
+#if __AIE_ARCH__ == 10
 
-#if __AIE_ARCH__ == 20 || __AIE_ARCH__ == 21 || __AIE_ARCH__ == 22
+#include "aie1/linear_approx.hpp"
+
+#elif __AIE_ARCH__ == 20 || __AIE_ARCH__ == 21 || __AIE_ARCH__ == 22
 
 #include "aie2/linear_approx.hpp"
 
@@ -55,10 +55,28 @@ struct lut<1, OffsetType, SlopeType>
       {}
 
   private:
+      // The AIE implementations support single-access tables
+      template <unsigned, typename, unsigned> friend struct lut_gather;
+      template <typename, typename, lut_oor_policy> friend struct parallel_lookup;
+      template <typename, typename> friend struct linear_approx;
+
       unsigned LUT_elems_;
       const void* LUT_a_;
 };
 
+// Width of the memory banks that the lookup tables are interleaved at
+static constexpr unsigned lut_bank_bytes = 16;
+
+// Position, in entries, of the given copy of entry i of a table laid out for two parallel accesses: each bank-width
+// line of entries is written twice in a row. Entries take EntryBytes bytes.
+template <unsigned EntryBytes>
+constexpr unsigned lut_interleaved_offset(unsigned i, unsigned copy)
+{
+    constexpr unsigned per_line = lut_bank_bytes / EntryBytes;
+
+    return (i / per_line) * 2 * per_line + copy * per_line + i % per_line;
+}
+
 }
 
 #endif
@@ -26,9 +26,11 @@ struct parallel_lookup;
 
 }
 
-//TODO: Support for parallel_lookup in AIE1?
+#if __AIE_ARCH__ == 10
 
-#if __AIE_ARCH__ == 20 || __AIE_ARCH__ == 21 || __AIE_ARCH__ == 22
+#include "aie1/parallel_lookup.hpp"
+
+#elif __AIE_ARCH__ == 20 || __AIE_ARCH__ == 21 || __AIE_ARCH__ == 22
 
 #include "aie2/parallel_lookup.hpp"
 
@@ -419,6 +419,752 @@ void fft_dit_r5_stage(const Input * __restrict x,
 }
 
 
+// Batched stages
+
+/**
+ * @ingroup group_fft
+ *
+ * A function to perform a single radix 2 FFT stage on a batch of independent transforms
+ *
+ * The data of the transforms must be interleaved, i.e. sample `i` of transform `b` is stored at position `i * Batch + b`.
+ * With this layout, the butterflies of all the transforms that use the same twiddle factors are computed together,
+ * so each twiddle group is loaded once and kept in registers for the whole batch, and the loop setup is shared by
+ * all the transforms. The same twiddle tables as for a single transform of `n` samples are used.
+ *
+ * @param x        Input data pointer
+ * @param tw       Twiddle group pointer
+ * @param n        Number of samples of each transform
+ * @param shift_tw Indicates the decimal point of the twiddles
+ * @param shift    Shift applied to apply to dit outputs
+ * @param inv      Run inverse FFT stage
+ * @param out      Output data pointer
+ *
+ * @tparam Vectorization Number of independent butterfly units in the stage of each transform.
+ * @tparam Batch         Number of interleaved transforms.
+ * @tparam Input         Type of the input elements.
+ * @tparam Output        Type of the output elements.
+ * @tparam Twiddle       Type of twiddle factors.
+ */
+template <unsigned Vectorization, unsigned Batch, typename Input, typename Output, typename Twiddle>
+    requires(arch::is(arch::Gen1, arch::Gen2))
+__aie_fft_inline
+void fft_dit_r2_stage_batched(const Input * __restrict x,
+                              const Twiddle * __restrict tw,
+                              unsigned n, unsigned shift_tw, unsigned shift, bool inv, Output * __restrict out)
+{
+    constexpr unsigned Radix = 2;
+    static_assert(detail::is_valid_fft_op_v<Radix, Input, Output, Twiddle>, "Requested FFT mode is not implemented");
+    static_assert(Batch > 0, "At least one transform is required");
+
+#if !AIE_API_DISABLE_ALIGNMENT_ASSERTIONS
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(x),   "Insufficient input alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(tw),  "Insufficient twiddle alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(out), "Insufficient output alignment");
+#endif
+
+    // Interleaved transforms are equivalent to a single stage with Batch times the vectorization over Batch times the
+    // samples, which uses the same twiddle tables
+    detail::fft_dit_stage<Radix, Vectorization * Batch, Input, Output, Twiddle>::run(x, tw, n * Batch, shift_tw, shift, inv, out);
+}
+
+/**
+ * @ingroup group_fft
+ *
+ * A function to perform a single radix 3 FFT stage on a batch of independent transforms
+ *
+ * The data of the transforms must be interleaved, i.e. sample `i` of transform `b` is stored at position `i * Batch + b`.
+ * The same twiddle tables as for a single transform of `n` samples are used.
+ *
+ * Defining the rotation rate of a given twiddle to be `w(tw)`, the relationship between the twiddle groups are
+ * @code
+ * w(tw0) < w(tw1)
+ * @endcode
+ *
+ * @param x        Input data pointer
+ * @param tw0      First twiddle group pointer
+ * @param tw1      Second twiddle group pointer
+ * @param n        Number of samples of each transform
+ * @param shift_tw Indicates the decimal point of the twiddles
+ * @param shift    Shift applied to apply to dit outputs
+ * @param inv      Run inverse FFT stage
+ * @param out      Output data pointer
+ *
+ * @tparam Vectorization Number of independent butterfly units in the stage of each transform.
+ * @tparam Batch         Number of interleaved transforms.
+ * @tparam Input         Type of the input elements.
+ * @tparam Output        Type of the output elements.
+ * @tparam Twiddle       Type of twiddle factors.
+ */
+template <unsigned Vectorization, unsigned Batch, typename Input, typename Output, typename Twiddle>
+    requires(arch::is(arch::Gen1, arch::Gen2))
+__aie_fft_inline
+void fft_dit_r3_stage_batched(const Input * __restrict x,
+                              const Twiddle * __restrict tw0,
+                              const Twiddle * __restrict tw1,
+                              unsigned n, unsigned shift_tw, unsigned shift, bool inv, Output * __restrict out)
+{
+    constexpr unsigned Radix = 3;
+    static_assert(detail::is_valid_fft_op_v<Radix, Input, Output, Twiddle>, "Requested FFT mode is not implemented");
+    static_assert(Batch > 0, "At least one transform is required");
+
+#if !AIE_API_DISABLE_ALIGNMENT_ASSERTIONS
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(x),   "Insufficient input alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(tw0), "Insufficient twiddle 0 alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(tw1), "Insufficient twiddle 1 alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(out), "Insufficient output alignment");
+#endif
+
+    detail::fft_dit_stage<Radix, Vectorization * Batch, Input, Output, Twiddle>::run(x, tw0, tw1, n * Batch, shift_tw, shift, inv, out);
+}
+
+/**
+ * @ingroup group_fft
+ *
+ * A function to perform a single radix 4 FFT stage on a batch of independent transforms
+ *
+ * The data of the transforms must be interleaved, i.e. sample `i` of transform `b` is stored at position `i * Batch + b`.
+ * The same twiddle tables as for a single transform of `n` samples are used.
+ *
+ * Defining the rotation rate of a given twiddle to be `w(tw)`, the relationship between the twiddle groups are
+ * @code
+ * w(tw1) < w(tw0) < w(tw2)
+ * @endcode
+ *
+ * @param x        Input data pointer
+ * @param tw0      First twiddle group pointer
+ * @param tw1      Second twiddle group pointer
+ * @param tw2      Third twiddle group pointer
+ * @param n        Number of samples of each transform
+ * @param shift_tw Indicates the decimal point of the twiddles
+ * @param shift    Shift applied to apply to dit outputs
+ * @param inv      Run inverse FFT stage
+ * @param out      Output data pointer
+ *
+ * @tparam Vectorization Number of independent butterfly units in the stage of each transform.
+ * @tparam Batch         Number of interleaved transforms.
+ * @tparam Input         Type of the input elements.
+ * @tparam Output        Type of the output elements.
+ * @tparam Twiddle       Type of twiddle factors.
+ */
+template <unsigned Vectorization, unsigned Batch, typename Input, typename Output, typename Twiddle>
+    requires(arch::is(arch::Gen1, arch::Gen2))
+__aie_fft_inline
+void fft_dit_r4_stage_batched(const Input * __restrict x,
+                              const Twiddle * __restrict tw0,
+                              const Twiddle * __restrict tw1,
+                              const Twiddle * __restrict tw2,
+                              unsigned n, unsigned shift_tw, unsigned shift, bool inv, Output * __restrict out)
+{
+    constexpr unsigned Radix = 4;
+    static_assert(detail::is_valid_fft_op_v<Radix, Input, Output, Twiddle>, "Requested FFT mode is not implemented");
+    static_assert(Batch > 0, "At least one transform is required");
+
+#if !AIE_API_DISABLE_ALIGNMENT_ASSERTIONS
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(x),   "Insufficient input alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(tw0), "Insufficient twiddle 0 alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(tw1), "Insufficient twiddle 1 alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(tw2), "Insufficient twiddle 2 alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(out), "Insufficient output alignment");
+#endif
+
+    detail::fft_dit_stage<Radix, Vectorization * Batch, Input, Output, Twiddle>::run(x, tw0, tw1, tw2, n * Batch, shift_tw, shift, inv, out);
+}
+
+/**
+ * @ingroup group_fft
+ *
+ * A function to perform a single radix 5 FFT stage on a batch of independent transforms
+ *
+ * The data of the transforms must be interleaved, i.e. sample `i` of transform `b` is stored at position `i * Batch + b`.
+ * The same twiddle tables as for a single transform of `n` samples are used.
+ *
+ * Defining the rotation rate of a given twiddle to be `w(tw)`, the relationship between the twiddle groups are
+ * @code
+ * w(tw0) < w(tw1) < w(tw2) < w(tw3)
+ * @endcode
+ *
+ * @param x        Input data pointer
+ * @param tw0      First twiddle group pointer
+ * @param tw1      Second twiddle group pointer
+ * @param tw2      Third twiddle group pointer
+ * @param tw3      Fourth twiddle group pointer
+ * @param n        Number of samples of each transform
+ * @param shift_tw Indicates the decimal point of the twiddles
+ * @param shift    Shift applied to apply to dit outputs
+ * @param inv      Run inverse FFT stage
+ * @param out      Output data pointer
+ *
+ * @tparam Vectorization Number of independent butterfly units in the stage of each transform.
+ * @tparam Batch         Number of interleaved transforms.
+ * @tparam Input         Type of the input elements.
+ * @tparam Output        Type of the output elements.
+ * @tparam Twiddle       Type of twiddle factors.
+ */
+template <unsigned Vectorization, unsigned Batch, typename Input, typename Output, typename Twiddle>
+    requires(arch::is(arch::Gen1, arch::Gen2))
+__aie_fft_inline
+void fft_dit_r5_stage_batched(const Input * __restrict x,
+                              const Twiddle * __restrict tw0,
+                              const Twiddle * __restrict tw1,
+                              const Twiddle * __restrict tw2,
+                              const Twiddle * __restrict tw3,
+                              unsigned n, unsigned shift_tw, unsigned shift, bool inv, Output * __restrict out)
+{
+    constexpr unsigned Radix = 5;
+    static_assert(detail::is_valid_fft_op_v<Radix, Input, Output, Twiddle>, "Requested FFT mode is not implemented");
+    static_assert(Batch > 0, "At least one transform is required");
+
+#if !AIE_API_DISABLE_ALIGNMENT_ASSERTIONS
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(x),   "Insufficient input alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(tw0), "Insufficient twiddle 0 alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(tw1), "Insufficient twiddle 1 alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(tw2), "Insufficient twiddle 2 alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(tw3), "Insufficient twiddle 3 alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(out), "Insufficient output alignment");
+#endif
+
+    detail::fft_dit_stage<Radix, Vectorization * Batch, Input, Output, Twiddle>::run(x, tw0, tw1, tw2, tw3, n * Batch, shift_tw, shift, inv, out);
+}
+
+/**
+ * @ingroup group_fft
+ *
+ * A function to perform a single floating point radix 2 FFT stage on a batch of independent transforms
+ *
+ * The data of the transforms must be interleaved, i.e. sample `i` of transform `b` is stored at position `i * Batch + b`.
+ * The same twiddle tables as for a single transform of `n` samples are used.
+ *
+ * @param x        Input data pointer
+ * @param tw       Twiddle group pointer
+ * @param n        Number of samples of each transform
+ * @param inv      Run inverse FFT stage
+ * @param out      Output data pointer
+ *
+ * @tparam Vectorization Number of independent butterfly units in the stage of each transform.
+ * @tparam Batch         Number of interleaved transforms.
+ * @tparam Input         Type of the input elements.
+ * @tparam Output        Type of the output elements.
+ * @tparam Twiddle       Type of twiddle factors.
+ */
+template <unsigned Vectorization, unsigned Batch, typename Input, typename Output, typename Twiddle>
+    requires(arch::is(arch::AIE, arch::AIE_ML, arch::AIE_MLv2) && detail::is_floating_point_v<Input>)
+__aie_fft_inline
+void fft_dit_r2_stage_batched(const Input * __restrict x,
+                              const Twiddle * __restrict tw,
+                              unsigned n, bool inv, Output * __restrict out)
+{
+    constexpr unsigned Radix = 2;
+    static_assert(detail::is_valid_fft_op_v<Radix, Input, Output, Twiddle>, "Requested FFT mode is not implemented");
+    static_assert(Batch > 0, "At least one transform is required");
+
+#if !AIE_API_DISABLE_ALIGNMENT_ASSERTIONS
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(x),   "Insufficient input alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(tw),  "Insufficient twiddle alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(out), "Insufficient output alignment");
+#endif
+
+    detail::fft_dit_stage<Radix, Vectorization * Batch, Input, Output, Twiddle>::run(x, tw, n * Batch, 0, 0, inv, out);
+}
+
+/**
+ * @ingroup group_fft
+ *
+ * A function to perform a single floating point radix 3 FFT stage on a batch of independent transforms
+ *
+ * The data of the transforms must be interleaved, i.e. sample `i` of transform `b` is stored at position `i * Batch + b`.
+ * The same twiddle tables as for a single transform of `n` samples are used.
+ *
+ * Defining the rotation rate of a given twiddle to be `w(tw)`, the relationship between the twiddle groups are
+ * @code
+ * w(tw0) < w(tw1)
+ * @endcode
+ *
+ * @param x        Input data pointer
+ * @param tw0      First twiddle group pointer
+ * @param tw1      Second twiddle group pointer
+ * @param n        Number of samples of each transform
+ * @param inv      Run inverse FFT stage
+ * @param out      Output data pointer
+ *
+ * @tparam Vectorization Number of independent butterfly units in the stage of each transform.
+ * @tparam Batch         Number of interleaved transforms.
+ * @tparam Input         Type of the input elements.
+ * @tparam Output        Type of the output elements.
+ * @tparam Twiddle       Type of twiddle factors.
+ */
+template <unsigned Vectorization, unsigned Batch, typename Input, typename Output, typename Twiddle>
+    requires(arch::is(arch::AIE, arch::AIE_ML, arch::AIE_MLv2) && detail::is_floating_point_v<Input>)
+__aie_fft_inline
+void fft_dit_r3_stage_batched(const Input * __restrict x,
+                              const Twiddle * __restrict tw0,
+                              const Twiddle * __restrict tw1,
+                              unsigned n, bool inv, Output * __restrict out)
+{
+    constexpr unsigned Radix = 3;
+    static_assert(detail::is_valid_fft_op_v<Radix, Input, Output, Twiddle>, "Requested FFT mode is not implemented");
+    static_assert(Batch > 0, "At least one transform is required");
+
+#if !AIE_API_DISABLE_ALIGNMENT_ASSERTIONS
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(x),   "Insufficient input alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(tw0), "Insufficient twiddle 0 alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(tw1), "Insufficient twiddle 1 alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(out), "Insufficient output alignment");
+#endif
+
+    detail::fft_dit_stage<Radix, Vectorization * Batch, Input, Output, Twiddle>::run(x, tw0, tw1, n * Batch, 0, 0, inv, out);
+}
+
+#if __AIE_API_CBF16_SUPPORT__
+/**
+ * @ingroup group_fft
+ *
+ * A function to perform a single floating point radix 4 FFT stage on a batch of independent transforms
+ *
+ * The data of the transforms must be interleaved, i.e. sample `i` of transform `b` is stored at position `i * Batch + b`.
+ * The same twiddle tables as for a single transform of `n` samples are used.
+ *
+ * Defining the rotation rate of a given twiddle to be `w(tw)`, the relationship between the twiddle groups are
+ * @code
+ * w(tw1) < w(tw0) < w(tw2)
+ * @endcode
+ *
+ * @param x        Input data pointer
+ * @param tw0      First twiddle group pointer
+ * @param tw1      Second twiddle group pointer
+ * @param tw2      Third twiddle group pointer
+ * @param n        Number of samples of each transform
+ * @param inv      Run inverse FFT stage
+ * @param out      Output data pointer
+ *
+ * @tparam Vectorization Number of independent butterfly units in the stage of each transform.
+ * @tparam Batch         Number of interleaved transforms.
+ * @tparam Input         Type of the input elements.
+ * @tparam Output        Type of the output elements.
+ * @tparam Twiddle       Type of twiddle factors.
+ */
+template <unsigned Vectorization, unsigned Batch, typename Input, typename Output, typename Twiddle>
+    requires(arch::is(arch::AIE_ML, arch::AIE_MLv2) && detail::is_floating_point_v<Input>)
+__aie_fft_inline
+void fft_dit_r4_stage_batched(const Input * __restrict x,
+                              const Twiddle * __restrict tw0,
+                              const Twiddle * __restrict tw1,
+                              const Twiddle * __restrict tw2,
+                              unsigned n, bool inv, Output * __restrict out)
+{
+    constexpr unsigned Radix = 4;
+    static_assert(detail::is_valid_fft_op_v<Radix, Input, Output, Twiddle>, "Requested FFT mode is not implemented");
+    static_assert(Batch > 0, "At least one transform is required");
+
+#if !AIE_API_DISABLE_ALIGNMENT_ASSERTIONS
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(x),   "Insufficient input alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(tw0), "Insufficient twiddle 0 alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(tw1), "Insufficient twiddle 1 alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(tw2), "Insufficient twiddle 2 alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(out), "Insufficient output alignment");
+#endif
+
+    detail::fft_dit_stage<Radix, Vectorization * Batch, Input, Output, Twiddle>::run(x, tw0, tw1, tw2, n * Batch, 0, 0, inv, out);
+}
+#endif
+
+/**
+ * @ingroup group_fft
+ *
+ * A function to perform a single floating point radix 5 FFT stage on a batch of independent transforms
+ *
+ * The data of the transforms must be interleaved, i.e. sample `i` of transform `b` is stored at position `i * Batch + b`.
+ * The same twiddle tables as for a single transform of `n` samples are used.
+ *
+ * Defining the rotation rate of a given twiddle to be `w(tw)`, the relationship between the twiddle groups are
+ * @code
+ * w(tw0) < w(tw1) < w(tw2) < w(tw3)
+ * @endcode
+ *
+ * @param x        Input data pointer
+ * @param tw0      First twiddle group pointer
+ * @param tw1      Second twiddle group pointer
+ * @param tw2      Third twiddle group pointer
+ * @param tw3      Fourth twiddle group pointer
+ * @param n        Number of samples of each transform
+ * @param inv      Run inverse FFT stage
+ * @param out      Output data pointer
+ *
+ * @tparam Vectorization Number of independent butterfly units in the stage of each transform.
+ * @tparam Batch         Number of interleaved transforms.
+ * @tparam Input         Type of the input elements.
+ * @tparam Output        Type of the output elements.
+ * @tparam Twiddle       Type of twiddle factors.
+ */
+template <unsigned Vectorization, unsigned Batch, typename Input, typename Output, typename Twiddle>
+    requires(arch::is(arch::AIE, arch::AIE_ML, arch::AIE_MLv2) && detail::is_floating_point_v<Input>)
+__aie_fft_inline
+void fft_dit_r5_stage_batched(const Input * __restrict x,
+                              const Twiddle * __restrict tw0,
+                              const Twiddle * __restrict tw1,
+                              const Twiddle * __restrict tw2,
+                              const Twiddle * __restrict tw3,
+                              unsigned n, bool inv, Output * __restrict out)
+{
+    constexpr unsigned Radix = 5;
+    static_assert(detail::is_valid_fft_op_v<Radix, Input, Output, Twiddle>, "Requested FFT mode is not implemented");
+    static_assert(Batch > 0, "At least one transform is required");
+
+#if !AIE_API_DISABLE_ALIGNMENT_ASSERTIONS
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(x),   "Insufficient input alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(tw0), "Insufficient twiddle 0 alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(tw1), "Insufficient twiddle 1 alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(tw2), "Insufficient twiddle 2 alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(tw3), "Insufficient twiddle 3 alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(out), "Insufficient output alignment");
+#endif
+
+    detail::fft_dit_stage<Radix, Vectorization * Batch, Input, Output, Twiddle>::run(x, tw0, tw1, tw2, tw3, n * Batch, 0, 0, inv, out);
+}
+
+// Epilogues
+
+/**
+ * @ingroup group_fft
+ *
+ * FFT stage epilogue that stores the squared magnitude of each output instead of the complex value. It can be passed
+ * to the last stage of a transform to compute a power spectrum without an additional pass over the output buffer.
+ *
+ * @code
+ * out[i] = stage_out[i].real² + stage_out[i].imag²;
+ * @endcode
+ *
+ * @tparam T  Type of the complex values computed by the stage.
+ * @tparam TR Type of the stored magnitudes. Defaults to int32 for integral types and float for floating point.
+ *
+ * @sa abs_square
+ */
+template <typename T, typename TR = std::conditional_t<detail::is_floating_point_v<T>, float, int32>>
+    requires(detail::is_complex_v<T> &&
+             ((!detail::is_floating_point_v<T> && Utils::is_one_of_v<TR, int32, int16>) ||
+              ( detail::is_floating_point_v<T> && std::is_same_v<TR, float>)))
+class fft_abs_square_epilogue
+{
+public:
+    using input_type  = T;
+    using output_type = TR;
+
+    /**
+     * @param shift Shift applied to the squared magnitudes (unused for float types)
+     */
+    constexpr explicit fft_abs_square_epilogue(int shift = 0) : shift_(shift)
+    {
+    }
+
+    template <unsigned Elems>
+    __aie_inline
+    vector<TR, Elems> operator()(const vector<T, Elems> &v) const
+    {
+        return detail::abs_square<T, TR, Elems>::run(v, shift_);
+    }
+
+private:
+    int shift_;
+};
+
+/**
+ * @ingroup group_fft
+ *
+ * FFT stage epilogue that stores the outputs unchanged and records the largest component magnitude seen, so the
+ * headroom of the stage outputs is known without scanning the output buffer again. It can be used to choose the shift
+ * of the following stage in block floating point schemes. The same object may be passed to several calls, in which
+ * case the headroom covers all the outputs stored since construction or the last call to reset().
+ *
+ * @tparam T Type of the complex values computed by the stage.
+ */
+template <typename T>
+    requires(Utils::is_one_of_v<T, cint16, cint32>)
+class fft_block_exponent_epilogue
+{
+    using component_type = detail::remove_complex_t<T>;
+
+    static constexpr unsigned component_bits = detail::type_bits_v<component_type>;
+    static constexpr unsigned state_elems    = 512 / component_bits;
+
+public:
+    using input_type  = T;
+    using output_type = T;
+
+    __aie_inline
+    fft_block_exponent_epilogue()
+    {
+        reset();
+    }
+
+    /**
+     * Discards the values recorded so far.
+     */
+    __aie_inline
+    void reset()
+    {
+        max_ = detail::broadcast<component_type, state_elems>::run(std::numeric_limits<component_type>::min());
+        min_ = detail::broadcast<component_type, state_elems>::run(std::numeric_limits<component_type>::max());
+    }
+
+    template <unsigned Elems>
+    __aie_inline
+    vector<T, Elems> operator()(const vector<T, Elems> &v)
+    {
+        const auto c = v.template cast_to<component_type>();
+
+        update(c, c);
+
+        return v;
+    }
+
+    /**
+     * Returns the number of redundant sign bits of the component with the largest magnitude, i.e. the number of bits
+     * by which all the recorded values could be shifted left without overflowing.
+     */
+    __aie_inline
+    unsigned headroom() const
+    {
+        const int64_t hi = detail::max_reduce<component_type, state_elems>::run(max_);
+        const int64_t lo = detail::min_reduce<component_type, state_elems>::run(min_);
+
+        // The ones' complement of a negative value has the same number of redundant sign bits
+        uint64_t mag = uint64_t(std::max(std::max(hi, -1 - lo), int64_t(0)));
+
+        unsigned bits = 0;
+        while (mag) {
+            mag >>= 1;
+            ++bits;
+        }
+
+        return component_bits - 1 - bits;
+    }
+
+private:
+    template <unsigned Elems>
+    __aie_inline
+    void update(const vector<component_type, Elems> &hi, const vector<component_type, Elems> &lo)
+    {
+        if constexpr (Elems > state_elems) {
+            update(detail::max<component_type, Elems / 2>::run(hi.template extract<Elems / 2>(0), hi.template extract<Elems / 2>(1)),
+                   detail::min<component_type, Elems / 2>::run(lo.template extract<Elems / 2>(0), lo.template extract<Elems / 2>(1)));
+        }
+        else if constexpr (Elems < state_elems) {
+            max_.insert(0, detail::max<component_type, Elems>::run(max_.template extract<Elems>(0), hi));
+            min_.insert(0, detail::min<component_type, Elems>::run(min_.template extract<Elems>(0), lo));
+        }
+        else {
+            max_ = detail::max<component_type, Elems>::run(max_, hi);
+            min_ = detail::min<component_type, Elems>::run(min_, lo);
+        }
+    }
+
+    vector<component_type, state_elems> max_;
+    vector<component_type, state_elems> min_;
+};
+
+// Stages with epilogues
+
+/**
+ * @ingroup group_fft
+ *
+ * A function to perform a single radix 2 FFT stage that applies an epilogue to the outputs before storing them
+ *
+ * The epilogue is called on each output vector right after the butterflies are computed and its result is what gets
+ * written to memory, e.g. fft_abs_square_epilogue stores the power spectrum directly when passed to the last stage of a
+ * transform. This saves the separate loop over the output buffer that would otherwise be needed. Stateful epilogues,
+ * such as fft_block_exponent_epilogue, must be passed as lvalues so their state can be queried after the stage.
+ *
+ * @param x        Input data pointer
+ * @param tw       Twiddle group pointer
+ * @param n        Number of samples
+ * @param shift_tw Indicates the decimal point of the twiddles (unused for float types)
+ * @param shift    Shift applied to apply to dit outputs (unused for float types)
+ * @param inv      Run inverse FFT stage
+ * @param out      Output data pointer, of the output type of the epilogue
+ * @param epilogue Operation applied to the outputs of the stage
+ *
+ * @tparam Vectorization Number of independent butterfly units in the stage.
+ * @tparam Input         Type of the input elements.
+ * @tparam Twiddle       Type of twiddle factors.
+ * @tparam Epilogue      Type of the epilogue. The output type of the stage is the input type of the epilogue.
+ */
+template <unsigned Vectorization, typename Input, typename Twiddle, typename Epilogue>
+    requires(arch::is(arch::AIE, arch::AIE_ML))
+__aie_fft_inline
+void fft_dit_r2_stage(const Input * __restrict x,
+                      const Twiddle * __restrict tw,
+                      unsigned n, unsigned shift_tw, unsigned shift, bool inv,
+                      detail::fft_epilogue_output_t<Epilogue> * __restrict out, Epilogue &&epilogue)
+{
+    constexpr unsigned Radix = 2;
+    using Output = detail::fft_epilogue_input_t<Epilogue>;
+    static_assert(detail::is_valid_fft_op_v<Radix, Input, Output, Twiddle>, "Requested FFT mode is not implemented");
+
+#if !AIE_API_DISABLE_ALIGNMENT_ASSERTIONS
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(x),   "Insufficient input alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(tw),  "Insufficient twiddle alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(out), "Insufficient output alignment");
+#endif
+
+    detail::fft_dit_stage<Radix, Vectorization, Input, Output, Twiddle>::run(x, tw, n, shift_tw, shift, inv, out,
+                                                                            std::forward<Epilogue>(epilogue));
+}
+
+/**
+ * @ingroup group_fft
+ *
+ * A function to perform a single radix 3 FFT stage that applies an epilogue to the outputs before storing them
+ *
+ * Defining the rotation rate of a given twiddle to be `w(tw)`, the relationship between the twiddle groups are
+ * @code
+ * w(tw0) < w(tw1)
+ * @endcode
+ *
+ * @param x        Input data pointer
+ * @param tw0      First twiddle group pointer
+ * @param tw1      Second twiddle group pointer
+ * @param n        Number of samples
+ * @param shift_tw Indicates the decimal point of the twiddles (unused for float types)
+ * @param shift    Shift applied to apply to dit outputs (unused for float types)
+ * @param inv      Run inverse FFT stage
+ * @param out      Output data pointer, of the output type of the epilogue
+ * @param epilogue Operation applied to the outputs of the stage
+ *
+ * @tparam Vectorization Number of independent butterfly units in the stage.
+ * @tparam Input         Type of the input elements.
+ * @tparam Twiddle       Type of twiddle factors.
+ * @tparam Epilogue      Type of the epilogue. The output type of the stage is the input type of the epilogue.
+ */
+template <unsigned Vectorization, typename Input, typename Twiddle, typename Epilogue>
+    requires(arch::is(arch::AIE, arch::AIE_ML))
+__aie_fft_inline
+void fft_dit_r3_stage(const Input * __restrict x,
+                      const Twiddle * __restrict tw0,
+                      const Twiddle * __restrict tw1,
+                      unsigned n, unsigned shift_tw, unsigned shift, bool inv,
+                      detail::fft_epilogue_output_t<Epilogue> * __restrict out, Epilogue &&epilogue)
+{
+    constexpr unsigned Radix = 3;
+    using Output = detail::fft_epilogue_input_t<Epilogue>;
+    static_assert(detail::is_valid_fft_op_v<Radix, Input, Output, Twiddle>, "Requested FFT mode is not implemented");
+
+#if !AIE_API_DISABLE_ALIGNMENT_ASSERTIONS
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(x),   "Insufficient input alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(tw0), "Insufficient twiddle 0 alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(tw1), "Insufficient twiddle 1 alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(out), "Insufficient output alignment");
+#endif
+
+    detail::fft_dit_stage<Radix, Vectorization, Input, Output, Twiddle>::run(x, tw0, tw1, n, shift_tw, shift, inv, out,
+                                                                            std::forward<Epilogue>(epilogue));
+}
+
+/**
+ * @ingroup group_fft
+ *
+ * A function to perform a single radix 4 FFT stage that applies an epilogue to the outputs before storing them
+ *
+ * Defining the rotation rate of a given twiddle to be `w(tw)`, the relationship between the twiddle groups are
+ * @code
+ * w(tw1) < w(tw0) < w(tw2)
+ * @endcode
+ *
+ * @param x        Input data pointer
+ * @param tw0      First twiddle group pointer
+ * @param tw1      Second twiddle group pointer
+ * @param tw2      Third twiddle group pointer
+ * @param n        Number of samples
+ * @param shift_tw Indicates the decimal point of the twiddles (unused for float types)
+ * @param shift    Shift applied to apply to dit outputs (unused for float types)
+ * @param inv      Run inverse FFT stage
+ * @param out      Output data pointer, of the output type of the epilogue
+ * @param epilogue Operation applied to the outputs of the stage
+ *
+ * @tparam Vectorization Number of independent butterfly units in the stage.
+ * @tparam Input         Type of the input elements.
+ * @tparam Twiddle       Type of twiddle factors.
+ * @tparam Epilogue      Type of the epilogue. The output type of the stage is the input type of the epilogue.
+ */
+template <unsigned Vectorization, typename Input, typename Twiddle, typename Epilogue>
+    requires(arch::is(arch::AIE, arch::AIE_ML))
+__aie_fft_inline
+void fft_dit_r4_stage(const Input * __restrict x,
+                      const Twiddle * __restrict tw0,
+                      const Twiddle * __restrict tw1,
+                      const Twiddle * __restrict tw2,
+                      unsigned n, unsigned shift_tw, unsigned shift, bool inv,
+                      detail::fft_epilogue_output_t<Epilogue> * __restrict out, Epilogue &&epilogue)
+{
+    constexpr unsigned Radix = 4;
+    using Output = detail::fft_epilogue_input_t<Epilogue>;
+    static_assert(detail::is_valid_fft_op_v<Radix, Input, Output, Twiddle>, "Requested FFT mode is not implemented");
+
+#if !AIE_API_DISABLE_ALIGNMENT_ASSERTIONS
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(x),   "Insufficient input alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(tw0), "Insufficient twiddle 0 alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(tw1), "Insufficient twiddle 1 alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(tw2), "Insufficient twiddle 2 alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(out), "Insufficient output alignment");
+#endif
+
+    detail::fft_dit_stage<Radix, Vectorization, Input, Output, Twiddle>::run(x, tw0, tw1, tw2, n, shift_tw, shift, inv, out,
+                                                                            std::forward<Epilogue>(epilogue));
+}
+
+/**
+ * @ingroup group_fft
+ *
+ * A function to perform a single radix 5 FFT stage that applies an epilogue to the outputs before storing them
+ *
+ * Defining the rotation rate of a given twiddle to be `w(tw)`, the relationship between the twiddle groups are
+ * @code
+ * w(tw0) < w(tw1) < w(tw2) < w(tw3)
+ * @endcode
+ *
+ * @param x        Input data pointer
+ * @param tw0      First twiddle group pointer
+ * @param tw1      Second twiddle group pointer
+ * @param tw2      Third twiddle group pointer
+ * @param tw3      Fourth twiddle group pointer
+ * @param n        Number of samples
+ * @param shift_tw Indicates the decimal point of the twiddles (unused for float types)
+ * @param shift    Shift applied to apply to dit outputs (unused for float types)
+ * @param inv      Run inverse FFT stage
+ * @param out      Output data pointer, of the output type of the epilogue
+ * @param epilogue Operation applied to the outputs of the stage
+ *
+ * @tparam Vectorization Number of independent butterfly units in the stage.
+ * @tparam Input         Type of the input elements.
+ * @tparam Twiddle       Type of twiddle factors.
+ * @tparam Epilogue      Type of the epilogue. The output type of the stage is the input type of the epilogue.
+ */
+template <unsigned Vectorization, typename Input, typename Twiddle, typename Epilogue>
+    requires(arch::is(arch::AIE, arch::AIE_ML))
+__aie_fft_inline
+void fft_dit_r5_stage(const Input * __restrict x,
+                      const Twiddle * __restrict tw0,
+                      const Twiddle * __restrict tw1,
+                      const Twiddle * __restrict tw2,
+                      const Twiddle * __restrict tw3,
+                      unsigned n, unsigned shift_tw, unsigned shift, bool inv,
+                      detail::fft_epilogue_output_t<Epilogue> * __restrict out, Epilogue &&epilogue)
+{
+    constexpr unsigned Radix = 5;
+    using Output = detail::fft_epilogue_input_t<Epilogue>;
+    static_assert(detail::is_valid_fft_op_v<Radix, Input, Output, Twiddle>, "Requested FFT mode is not implemented");
+
+#if !AIE_API_DISABLE_ALIGNMENT_ASSERTIONS
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(x),   "Insufficient input alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(tw0), "Insufficient twiddle 0 alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(tw1), "Insufficient twiddle 1 alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(tw2), "Insufficient twiddle 2 alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(tw3), "Insufficient twiddle 3 alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(out), "Insufficient output alignment");
+#endif
+
+    detail::fft_dit_stage<Radix, Vectorization, Input, Output, Twiddle>::run(x, tw0, tw1, tw2, tw3, n, shift_tw, shift, inv, out,
+                                                                            std::forward<Epilogue>(epilogue));
+}
+
 // Dynamic vectorization
 
 /**
@@ -743,6 +1489,201 @@ void fft_dit_r5_stage(const Input * __restrict x,
     detail::fft_dit_stage_dyn_vec<Radix, Input, Output, Twiddle>::run(x, tw0, tw1, tw2, tw3, n, vectorization, 0, 0, inv, out);
 }
 
+/**
+ * @ingroup group_fft
+ *
+ * Type that computes a complete N-point decimation-in-time FFT using the stage-based interface.
+ *
+ * The sequence of stages is chosen at compile time: among all the decompositions of N into the radices and
+ * vectorizations implemented for the given types on the current architecture, the plan uses one with the fewest stages,
+ * which minimizes the number of passes over the data. The twiddle tables for all the stages are generated at compile
+ * time, rounded to the nearest value, and stored in a single constant array with the alignment required by the stages.
+ *
+ * Results ping-pong between a user-provided scratch buffer and the output buffer, so that the last stage always writes
+ * into the output buffer. Intermediate results use the widest of the input and output types.
+ *
+ * @code
+ * using plan = aie::fft_plan<512, cint16>;
+ *
+ * alignas(aie::vector_decl_align) static cint16 tmp[plan::scratch_size];
+ *
+ * plan::run(x, 0, false, tmp, y);
+ * @endcode
+ *
+ * @tparam N            Number of samples of the transform.
+ * @tparam Input        Type of the input elements.
+ * @tparam Output       Type of the output elements. Defaults to input type.
+ * @tparam Twiddle      Type of twiddle factors. Defaults to cint16 for integral types and cfloat for floating point.
+ * @tparam TwiddleShift Decimal point of the generated twiddles (ignored for floating point types). Defaults to 15 for
+ *                      cint16 and 31 for cint32 twiddles.
+ *
+ * @sa fft_dit_r2_stage, fft_dit_r3_stage, fft_dit_r4_stage, fft_dit_r5_stage
+ */
+template <unsigned N, typename Input, typename Output = Input,
+          typename Twiddle = detail::default_twiddle_type_t<Input, Output>,
+          unsigned TwiddleShift = detail::fft_default_twiddle_shift_v<Twiddle>>
+class fft_plan
+{
+    using plan = detail::fft_plan<N, Input, Output, Twiddle, TwiddleShift>;
+
+public:
+    using input_type        = Input;
+    using output_type       = Output;
+    using twiddle_type      = Twiddle;
+    /** Type used to store the results of intermediate stages */
+    using intermediate_type = typename plan::intermediate_type;
+
+    /** Number of samples of the transform */
+    static constexpr unsigned size          = N;
+    /** Decimal point of the generated twiddles */
+    static constexpr unsigned twiddle_shift = TwiddleShift;
+    /** Number of stages (passes over the data) used by the plan */
+    static constexpr unsigned num_stages    = plan::num_stages;
+    /** Minimum number of elements of type intermediate_type of the scratch buffer given to run */
+    static constexpr unsigned scratch_size  = plan::scratch_size;
+
+    /**
+     * Returns the radix of the given stage.
+     *
+     * @param stage Stage index, in execution order.
+     */
+    static constexpr unsigned radix(unsigned stage)
+    {
+        return plan::radices[stage];
+    }
+
+    /**
+     * Returns the vectorization of the given stage.
+     *
+     * @param stage Stage index, in execution order.
+     */
+    static constexpr unsigned vectorization(unsigned stage)
+    {
+        return plan::vectorizations[stage];
+    }
+
+    /**
+     * Computes the FFT.
+     *
+     * @param x     Input data pointer
+     * @param shift Additional shift applied to the outputs of every stage, on top of the twiddle decimal point. Use 0
+     *              to compute an unscaled transform.
+     * @param inv   Run inverse FFT
+     * @param tmp   Scratch buffer of at least scratch_size elements. Not accessed if scratch_size is 0.
+     * @param out   Output data pointer
+     */
+    __aie_fft_inline
+    static void run(const Input * __restrict x, unsigned shift, bool inv,
+                    intermediate_type * __restrict tmp, Output * __restrict out)
+        requires(arch::is(arch::Gen1, arch::Gen2) && !detail::is_floating_point_v<Input>)
+    {
+#if !AIE_API_DISABLE_ALIGNMENT_ASSERTIONS
+        RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(x),   "Insufficient input alignment");
+        RUNTIME_ASSERT_NO_ASSUME(scratch_size == 0 || detail::check_vector_alignment(tmp), "Insufficient scratch alignment");
+        RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(out), "Insufficient output alignment");
+#endif
+
+        plan::run(x, TwiddleShift, TwiddleShift + shift, inv, tmp, out);
+    }
+
+    /**
+     * Computes the floating point FFT.
+     *
+     * @param x     Input data pointer
+     * @param inv   Run inverse FFT
+     * @param tmp   Scratch buffer of at least scratch_size elements. Not accessed if scratch_size is 0.
+     * @param out   Output data pointer
+     */
+    __aie_fft_inline
+    static void run(const Input * __restrict x, bool inv,
+                    intermediate_type * __restrict tmp, Output * __restrict out)
+        requires(arch::is(arch::AIE, arch::AIE_ML, arch::AIE_MLv2) && detail::is_floating_point_v<Input>)
+    {
+#if !AIE_API_DISABLE_ALIGNMENT_ASSERTIONS
+        RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(x),   "Insufficient input alignment");
+        RUNTIME_ASSERT_NO_ASSUME(scratch_size == 0 || detail::check_vector_alignment(tmp), "Insufficient scratch alignment");
+        RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(out), "Insufficient output alignment");
+#endif
+
+        plan::run(x, 0, 0, inv, tmp, out);
+    }
+
+    /**
+     * Computes the FFT in block floating point. Instead of applying a fixed shift to every stage, the shift of each
+     * stage is chosen from the headroom of its inputs, which is measured while the previous stage stores its outputs
+     * (see fft_block_exponent_epilogue). Stages are only scaled down when their worst-case growth could overflow, so
+     * quiet signals keep their precision. The shifts applied by all the stages are returned as the block exponent:
+     *
+     * @code
+     * fft(x) = out * 2^exponent
+     * @endcode
+     *
+     * @param x              Input data pointer
+     * @param input_headroom Number of redundant sign bits of the input components, if known. With the default of 0
+     *                       the input is assumed to use the full range of its type.
+     * @param inv            Run inverse FFT
+     * @param tmp            Scratch buffer of at least scratch_size elements. Not accessed if scratch_size is 0.
+     * @param out            Output data pointer
+     *
+     * @return Block exponent of the outputs.
+     */
+    __aie_fft_inline
+    static unsigned run_block_floating_point(const Input * __restrict x, unsigned input_headroom, bool inv,
+                                             intermediate_type * __restrict tmp, Output * __restrict out)
+        requires(arch::is(arch::AIE, arch::AIE_ML) && Utils::is_one_of_v<intermediate_type, cint16, cint32>)
+    {
+#if !AIE_API_DISABLE_ALIGNMENT_ASSERTIONS
+        RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(x),   "Insufficient input alignment");
+        RUNTIME_ASSERT_NO_ASSUME(scratch_size == 0 || detail::check_vector_alignment(tmp), "Insufficient scratch alignment");
+        RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(out), "Insufficient output alignment");
+#endif
+
+        return run_block_floating_point_stages(x, input_headroom, inv, tmp, out);
+    }
+
+    /**
+     * Returns a pointer to the given twiddle table of the given stage, in the order expected by the corresponding
+     * fft_dit_r*_stage function. This allows reusing the generated tables in user-defined stage sequences.
+     *
+     * @tparam Stage Stage index, in execution order.
+     * @tparam Table Twiddle group index within the stage.
+     */
+    template <unsigned Stage, unsigned Table>
+    static const Twiddle *twiddles()
+    {
+        static_assert(Stage < num_stages && Table + 1 < plan::radices[Stage], "Invalid twiddle table");
+
+        return plan::template twiddles<Stage, Table>();
+    }
+
+private:
+    template <unsigned Stage = 0, typename T>
+    __aie_inline
+    static unsigned run_block_floating_point_stages(const T *x, unsigned headroom, bool inv,
+                                                    intermediate_type *tmp, Output *out)
+    {
+        // A radix R butterfly increases the magnitude of the components by up to 1 + (R - 1) * sqrt(2)
+        constexpr unsigned growth = plan::radices[Stage] <= 3? 2 : 3;
+
+        const unsigned shift = growth > headroom? growth - headroom : 0;
+
+        if constexpr (Stage + 1 == num_stages) {
+            plan::template run_stage<Stage>(x, TwiddleShift, TwiddleShift + shift, inv, out);
+
+            return shift;
+        }
+        else {
+            intermediate_type *dst = plan::template stage_output<Stage>(tmp, out);
+            fft_block_exponent_epilogue<intermediate_type> block;
+
+            plan::template run_stage<Stage>(x, TwiddleShift, TwiddleShift + shift, inv, dst, block);
+
+            return shift + run_block_floating_point_stages<Stage + 1>((const intermediate_type *)dst, block.headroom(),
+                                                                      inv, tmp, out);
+        }
+    }
+};
+
 } // namespace aie
 
 #endif
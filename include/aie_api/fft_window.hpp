@@ -0,0 +1,298 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2022 Xilinx, Inc.
+// Copyright (C) 2022-2026 Advanced Micro Devices, Inc.
+
+/**
+ * @file
+ * @brief First FFT stages that apply a window to the input samples.
+ */
+
+#pragma once
+
+#ifndef __AIE_API_FFT_WINDOW__HPP__
+#define __AIE_API_FFT_WINDOW__HPP__
+
+namespace aie {
+
+/**
+ * @ingroup group_fft
+ *
+ * A function to perform the first radix 2 stage of an FFT on windowed input samples.
+ *
+ * It is equivalent to multiplying the input samples by the window and then running
+ * `fft_dit_r2_stage<n / 2>`, but the window is applied while the butterflies are computed, so the windowed samples are
+ * never written to memory. The products are kept in the accumulators, so the window does not add any rounding step.
+ *
+ * @code
+ * out[k]         = (x[k] * window[k] + x[k + n / 2] * window[k + n / 2]) >> shift;
+ * out[k + n / 2] = (x[k] * window[k] - x[k + n / 2] * window[k + n / 2]) >> shift;
+ * @endcode
+ *
+ * @param x      Input data pointer
+ * @param window Window coefficients, one per input sample
+ * @param n      Number of samples. It must be a multiple of 2 times the number of lanes processed per iteration, which
+ *               is the number of elements of the input type that fit in 256 bits.
+ * @param shift  Shift applied to the outputs, which includes the decimal point of the window coefficients
+ * @param inv    Run inverse FFT stage (has no effect in radix 2 first stages)
+ * @param out    Output data pointer
+ *
+ * @tparam Input  Type of the input elements.
+ * @tparam Window Type of the window coefficients.
+ * @tparam Output Type of the output elements.
+ */
+template <typename Input, typename Window, typename Output>
+    requires(detail::is_complex_v<Input> && !detail::is_complex_v<Window> && !detail::is_floating_point_v<Input> &&
+             is_valid_mul_op_v<Input, Window>)
+__aie_fft_inline
+void fft_dit_r2_stage_windowed(const Input * __restrict x,
+                               const Window * __restrict window,
+                               unsigned n, unsigned shift, bool inv, Output * __restrict out)
+{
+    // Vectors of 256b are supported by the multiplications of all complex types with their real counterparts
+    constexpr unsigned Lanes = 256 / detail::type_bits_v<Input>;
+
+    REQUIRES_MSG(n >= 2 * Lanes && n % (2 * Lanes) == 0, "The number of samples must be a multiple of 2 vectors");
+
+#if !AIE_API_DISABLE_ALIGNMENT_ASSERTIONS
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(x),      "Insufficient input alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(window), "Insufficient window alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(out),    "Insufficient output alignment");
+#endif
+
+    auto it_x0   = cbegin_restrict_vector<Lanes>(x);
+    auto it_x1   = cbegin_restrict_vector<Lanes>(x + n / 2);
+    auto it_w0   = cbegin_restrict_vector<Lanes>(window);
+    auto it_w1   = cbegin_restrict_vector<Lanes>(window + n / 2);
+    auto it_out0 = begin_restrict_vector<Lanes>(out);
+    auto it_out1 = begin_restrict_vector<Lanes>(out + n / 2);
+
+    for (unsigned j = 0; j < n / (2 * Lanes); ++j)
+        chess_prepare_for_pipelining
+        chess_loop_range(1,)
+    {
+        const auto y0 = mul(*it_x0++, *it_w0++);
+        const auto x1 = *it_x1++;
+        const auto w1 = *it_w1++;
+
+        *it_out0++ = mac(y0, x1, w1).template to_vector<Output>(shift);
+        *it_out1++ = msc(y0, x1, w1).template to_vector<Output>(shift);
+    }
+}
+
+/**
+ * @ingroup group_fft
+ *
+ * A function to perform the first radix 4 stage of an FFT on windowed input samples.
+ *
+ * It is equivalent to multiplying the input samples by the window and then running
+ * `fft_dit_r4_stage<n / 4>`, but the window is applied while the butterflies are computed, so the windowed samples are
+ * never written to memory. The rotations by ±j are applied to the input samples before the window with a
+ * multiplication, so the window does not add any rounding step. The rotation is exact except for components equal to
+ * the most negative value of their type (e.g. -32768 for cint16), which saturate when they are negated.
+ *
+ * @param x      Input data pointer
+ * @param window Window coefficients, one per input sample
+ * @param n      Number of samples. It must be a multiple of 4 times the number of lanes processed per iteration, which
+ *               is the number of elements of the input type that fit in 256 bits.
+ * @param shift  Shift applied to the outputs, which includes the decimal point of the window coefficients
+ * @param inv    Run inverse FFT stage
+ * @param out    Output data pointer
+ *
+ * @tparam Input  Type of the input elements.
+ * @tparam Window Type of the window coefficients.
+ * @tparam Output Type of the output elements.
+ */
+template <typename Input, typename Window, typename Output>
+    requires(detail::is_complex_v<Input> && !detail::is_complex_v<Window> && !detail::is_floating_point_v<Input> &&
+             is_valid_mul_op_v<Input, Window>)
+__aie_fft_inline
+void fft_dit_r4_stage_windowed(const Input * __restrict x,
+                               const Window * __restrict window,
+                               unsigned n, unsigned shift, bool inv, Output * __restrict out)
+{
+    constexpr unsigned Lanes = 256 / detail::type_bits_v<Input>;
+
+    REQUIRES_MSG(n >= 4 * Lanes && n % (4 * Lanes) == 0, "The number of samples must be a multiple of 4 vectors");
+
+#if !AIE_API_DISABLE_ALIGNMENT_ASSERTIONS
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(x),      "Insufficient input alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(window), "Insufficient window alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(out),    "Insufficient output alignment");
+#endif
+
+    // Forward transforms rotate by -j and inverse transforms by j
+    const Input rot = inv? Input{0, 1} : Input{0, -1};
+
+    auto it_x0   = cbegin_restrict_vector<Lanes>(x);
+    auto it_x1   = cbegin_restrict_vector<Lanes>(x + n / 4);
+    auto it_x2   = cbegin_restrict_vector<Lanes>(x + n / 2);
+    auto it_x3   = cbegin_restrict_vector<Lanes>(x + 3 * n / 4);
+    auto it_w0   = cbegin_restrict_vector<Lanes>(window);
+    auto it_w1   = cbegin_restrict_vector<Lanes>(window + n / 4);
+    auto it_w2   = cbegin_restrict_vector<Lanes>(window + n / 2);
+    auto it_w3   = cbegin_restrict_vector<Lanes>(window + 3 * n / 4);
+    auto it_out0 = begin_restrict_vector<Lanes>(out);
+    auto it_out1 = begin_restrict_vector<Lanes>(out + n / 4);
+    auto it_out2 = begin_restrict_vector<Lanes>(out + n / 2);
+    auto it_out3 = begin_restrict_vector<Lanes>(out + 3 * n / 4);
+
+    for (unsigned j = 0; j < n / (4 * Lanes); ++j)
+        chess_prepare_for_pipelining
+        chess_loop_range(1,)
+    {
+        const auto x0 = *it_x0++; const auto w0 = *it_w0++;
+        const auto x1 = *it_x1++; const auto w1 = *it_w1++;
+        const auto x2 = *it_x2++; const auto w2 = *it_w2++;
+        const auto x3 = *it_x3++; const auto w3 = *it_w3++;
+
+        const vector<Input, Lanes> r1 = mul(x1, rot).template to_vector<Input>();
+        const vector<Input, Lanes> r3 = mul(x3, rot).template to_vector<Input>();
+
+        const auto y0 = mul(x0, w0);
+        const auto a  = mac(y0, x2, w2);               // y0 + y2
+        const auto b  = msc(y0, x2, w2);               // y0 - y2
+        const auto c  = mac(mul(x1, w1), x3, w3);      // y1 + y3
+        const auto d  = msc(mul(r1, w1), r3, w3);      // rot * (y1 - y3)
+
+        *it_out0++ = add(a, c).template to_vector<Output>(shift);
+        *it_out1++ = add(b, d).template to_vector<Output>(shift);
+        *it_out2++ = sub(a, c).template to_vector<Output>(shift);
+        *it_out3++ = sub(b, d).template to_vector<Output>(shift);
+    }
+}
+
+/**
+ * @ingroup group_fft
+ *
+ * A function to perform the first floating point radix 2 stage of an FFT on windowed input samples.
+ *
+ * @param x      Input data pointer
+ * @param window Window coefficients, one per input sample
+ * @param n      Number of samples. It must be a multiple of 2 times the number of lanes processed per iteration, which
+ *               is the number of elements of the input type that fit in 256 bits.
+ * @param inv    Run inverse FFT stage (has no effect in radix 2 first stages)
+ * @param out    Output data pointer
+ *
+ * @tparam Input  Type of the input elements.
+ * @tparam Window Type of the window coefficients.
+ * @tparam Output Type of the output elements.
+ *
+ * @sa fft_dit_r2_stage_windowed
+ */
+template <typename Input, typename Window, typename Output>
+    requires(detail::is_complex_v<Input> && !detail::is_complex_v<Window> && detail::is_floating_point_v<Input> &&
+             is_valid_mul_op_v<Input, Window>)
+__aie_fft_inline
+void fft_dit_r2_stage_windowed(const Input * __restrict x,
+                               const Window * __restrict window,
+                               unsigned n, bool inv, Output * __restrict out)
+{
+    constexpr unsigned Lanes = 256 / detail::type_bits_v<Input>;
+
+    REQUIRES_MSG(n >= 2 * Lanes && n % (2 * Lanes) == 0, "The number of samples must be a multiple of 2 vectors");
+
+#if !AIE_API_DISABLE_ALIGNMENT_ASSERTIONS
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(x),      "Insufficient input alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(window), "Insufficient window alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(out),    "Insufficient output alignment");
+#endif
+
+    auto it_x0   = cbegin_restrict_vector<Lanes>(x);
+    auto it_x1   = cbegin_restrict_vector<Lanes>(x + n / 2);
+    auto it_w0   = cbegin_restrict_vector<Lanes>(window);
+    auto it_w1   = cbegin_restrict_vector<Lanes>(window + n / 2);
+    auto it_out0 = begin_restrict_vector<Lanes>(out);
+    auto it_out1 = begin_restrict_vector<Lanes>(out + n / 2);
+
+    for (unsigned j = 0; j < n / (2 * Lanes); ++j)
+        chess_prepare_for_pipelining
+        chess_loop_range(1,)
+    {
+        const auto y0 = mul(*it_x0++, *it_w0++);
+        const auto x1 = *it_x1++;
+        const auto w1 = *it_w1++;
+
+        *it_out0++ = mac(y0, x1, w1).template to_vector<Output>();
+        *it_out1++ = msc(y0, x1, w1).template to_vector<Output>();
+    }
+}
+
+/**
+ * @ingroup group_fft
+ *
+ * A function to perform the first floating point radix 4 stage of an FFT on windowed input samples.
+ *
+ * @param x      Input data pointer
+ * @param window Window coefficients, one per input sample
+ * @param n      Number of samples. It must be a multiple of 4 times the number of lanes processed per iteration, which
+ *               is the number of elements of the input type that fit in 256 bits.
+ * @param inv    Run inverse FFT stage
+ * @param out    Output data pointer
+ *
+ * @tparam Input  Type of the input elements.
+ * @tparam Window Type of the window coefficients.
+ * @tparam Output Type of the output elements.
+ *
+ * @sa fft_dit_r4_stage_windowed
+ */
+template <typename Input, typename Window, typename Output>
+    requires(detail::is_complex_v<Input> && !detail::is_complex_v<Window> && detail::is_floating_point_v<Input> &&
+             is_valid_mul_op_v<Input, Window>)
+__aie_fft_inline
+void fft_dit_r4_stage_windowed(const Input * __restrict x,
+                               const Window * __restrict window,
+                               unsigned n, bool inv, Output * __restrict out)
+{
+    constexpr unsigned Lanes = 256 / detail::type_bits_v<Input>;
+
+    REQUIRES_MSG(n >= 4 * Lanes && n % (4 * Lanes) == 0, "The number of samples must be a multiple of 4 vectors");
+
+#if !AIE_API_DISABLE_ALIGNMENT_ASSERTIONS
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(x),      "Insufficient input alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(window), "Insufficient window alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment(out),    "Insufficient output alignment");
+#endif
+
+    const Input rot = inv? Input{0, 1} : Input{0, -1};
+
+    auto it_x0   = cbegin_restrict_vector<Lanes>(x);
+    auto it_x1   = cbegin_restrict_vector<Lanes>(x + n / 4);
+    auto it_x2   = cbegin_restrict_vector<Lanes>(x + n / 2);
+    auto it_x3   = cbegin_restrict_vector<Lanes>(x + 3 * n / 4);
+    auto it_w0   = cbegin_restrict_vector<Lanes>(window);
+    auto it_w1   = cbegin_restrict_vector<Lanes>(window + n / 4);
+    auto it_w2   = cbegin_restrict_vector<Lanes>(window + n / 2);
+    auto it_w3   = cbegin_restrict_vector<Lanes>(window + 3 * n / 4);
+    auto it_out0 = begin_restrict_vector<Lanes>(out);
+    auto it_out1 = begin_restrict_vector<Lanes>(out + n / 4);
+    auto it_out2 = begin_restrict_vector<Lanes>(out + n / 2);
+    auto it_out3 = begin_restrict_vector<Lanes>(out + 3 * n / 4);
+
+    for (unsigned j = 0; j < n / (4 * Lanes); ++j)
+        chess_prepare_for_pipelining
+        chess_loop_range(1,)
+    {
+        const auto x0 = *it_x0++; const auto w0 = *it_w0++;
+        const auto x1 = *it_x1++; const auto w1 = *it_w1++;
+        const auto x2 = *it_x2++; const auto w2 = *it_w2++;
+        const auto x3 = *it_x3++; const auto w3 = *it_w3++;
+
+        const vector<Input, Lanes> r1 = mul(x1, rot).template to_vector<Input>();
+        const vector<Input, Lanes> r3 = mul(x3, rot).template to_vector<Input>();
+
+        const auto y0 = mul(x0, w0);
+        const auto a  = mac(y0, x2, w2);
+        const auto b  = msc(y0, x2, w2);
+        const auto c  = mac(mul(x1, w1), x3, w3);
+        const auto d  = msc(mul(r1, w1), r3, w3);
+
+        *it_out0++ = add(a, c).template to_vector<Output>();
+        *it_out1++ = add(b, d).template to_vector<Output>();
+        *it_out2++ = sub(a, c).template to_vector<Output>();
+        *it_out3++ = sub(b, d).template to_vector<Output>();
+    }
+}
+
+} // namespace aie
+
+#endif
@@ -0,0 +1,1523 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2022 Xilinx, Inc.
+// Copyright (C) 2022-2026 Advanced Micro Devices, Inc.
+
+/**
+ * @file
+ * @brief Streaming FIR filters and correlators built on top of sliding_mul_ops.
+ */
+
+#pragma once
+
+#ifndef __AIE_API_FIR__HPP__
+#define __AIE_API_FIR__HPP__
+
+namespace aie {
+
+namespace detail {
+
+template <unsigned Lanes, unsigned Points, typename CoeffType, typename DataType, typename AccumTag>
+using fir_mul_ops = sliding_mul_ops<Lanes, Points, 1, 1, 1, CoeffType, DataType, AccumTag>;
+
+// Number of points computed by a single sliding multiplication intrinsic. 16 points is a multiple of the native points
+// of all the supported modes.
+template <unsigned Lanes, typename CoeffType, typename DataType, typename AccumTag>
+static constexpr unsigned fir_native_points = fir_mul_ops<Lanes, 16, CoeffType, DataType, AccumTag>::columns_per_mul;
+
+// Number of elements of the data vectors loaded from the delay line. Data is loaded in granules of up to 256b, and a
+// chunk reads Lanes + Points - 1 samples starting at any position of its first granule.
+static constexpr unsigned fir_data_elems(unsigned lanes, unsigned points, unsigned granule)
+{
+    const unsigned granules = utils::ceildiv(granule - 1 + lanes + points - 1, granule);
+
+    unsigned ret = 1;
+    while (ret < granules)
+        ret *= 2;
+
+    return ret * granule;
+}
+
+// Number of points of the main chunks of a filter. Any multiple of the native points wastes no more multiplications
+// than the native points themselves, as the last chunk only covers the remaining taps. Larger chunks need fewer data
+// loads, so the chunks are made as large as the coefficient and data vectors allow.
+static constexpr unsigned fir_chunk_points(unsigned taps, unsigned lanes, unsigned native_points,
+                                           unsigned coeff_elems, unsigned data_bits, unsigned granule)
+{
+    const unsigned padded_taps = utils::ceildiv(taps, native_points) * native_points;
+
+    unsigned points = native_points;
+
+    while (2 * points <= padded_taps &&
+           2 * points <= coeff_elems &&
+           fir_data_elems(lanes, 2 * points, granule) * data_bits <= 1024)
+        points *= 2;
+
+    return points;
+}
+
+// Distributes coefficients into vectors. Position i of the vectors holds coeffs[index[i]], or zero if index[i] is
+// negative or i is not covered by index.
+template <unsigned CoeffElems, unsigned CoeffVectors, typename CoeffType, size_t N>
+static std::array<vector<CoeffType, CoeffElems>, CoeffVectors> fir_make_coeffs(const CoeffType *coeffs,
+                                                                                const std::array<int, N> &index)
+{
+    static_assert(N <= CoeffElems * CoeffVectors);
+
+    std::array<vector<CoeffType, CoeffElems>, CoeffVectors> ret;
+
+    for (unsigned i = 0; i < CoeffVectors; ++i) {
+        ret[i] = aie::zeros<CoeffType, CoeffElems>();
+
+        for (unsigned j = 0; j < CoeffElems && i * CoeffElems + j < N; ++j) {
+            if (index[i * CoeffElems + j] >= 0)
+                ret[i].set(coeffs[index[i * CoeffElems + j]], j);
+        }
+    }
+
+    return ret;
+}
+
+// Splits the taps of a filter into sliding multiplications and computes them over the window returned by a
+// fir_delay_line with Taps + Delay taps and the same number of lanes. The taps are applied to the oldest Taps samples of
+// the window, so the input of the filter is delayed by Delay samples.
+template <unsigned Taps, unsigned Lanes, typename CoeffType, typename DataType, typename AccumTag, unsigned Delay = 0>
+struct fir_chunks
+{
+    using accum_type = accum<accum_tag_or_default_t<AccumTag, CoeffType, DataType>, Lanes>;
+
+    static constexpr unsigned data_bits     = type_bits_v<DataType>;
+    static constexpr unsigned native_points = fir_native_points<Lanes, CoeffType, DataType, AccumTag>;
+    static constexpr unsigned coeff_elems   = fir_mul_ops<Lanes, native_points, CoeffType, DataType, AccumTag>::max_coeff_bits / type_bits_v<CoeffType>;
+    static constexpr unsigned granule       = std::min(Lanes, 256 / data_bits);
+
+    static_assert(coeff_elems % native_points == 0);
+    static_assert(fir_data_elems(Lanes, native_points, granule) * data_bits <= 1024,
+                  "Lanes is too large for the given types");
+
+    static constexpr unsigned points         = fir_chunk_points(Taps, Lanes, native_points, coeff_elems, data_bits, granule);
+    static constexpr unsigned tail_points    = Taps % points? utils::ceildiv(Taps % points, native_points) * native_points : 0;
+    static constexpr unsigned main_chunks    = Taps / points;
+    static constexpr unsigned chunks         = main_chunks + (tail_points? 1 : 0);
+    static constexpr unsigned data_elems     = fir_data_elems(Lanes, points, granule);
+    static constexpr unsigned coeff_vectors  = utils::ceildiv(main_chunks * points + tail_points, coeff_elems);
+    static constexpr unsigned history_blocks = utils::ceildiv(Taps + Delay - 1, Lanes);
+
+    // Position of the oldest sample used by the first output within the first block of the window
+    static constexpr unsigned window_offset  = history_blocks * Lanes - (Taps + Delay - 1);
+
+    using coeff_storage = std::array<vector<CoeffType, coeff_elems>, coeff_vectors>;
+
+    template <unsigned Points>
+    using partial_type = partial_sliding_mul<Lanes, Points, 1, 1, 1, CoeffType, DataType, AccumTag>;
+
+    // Partial results that hold the accumulation of the first and the last chunk
+    using first_partial = partial_type<main_chunks? points : tail_points>;
+    using  last_partial = partial_type<tail_points? tail_points : points>;
+
+    template <size_t N>
+    static coeff_storage make_coeffs(const CoeffType *coeffs, const std::array<int, N> &index)
+    {
+        static_assert(N == Taps);
+
+        return fir_make_coeffs<coeff_elems, coeff_vectors>(coeffs, index);
+    }
+
+    static constexpr unsigned chunk_points(unsigned chunk)
+    {
+        return chunk < main_chunks? points : tail_points;
+    }
+
+    static constexpr unsigned data_start(unsigned chunk)
+    {
+        return (window_offset + chunk * points) % granule;
+    }
+
+    // Loads the samples read by the given chunk, starting at the granule that contains the first of them
+    template <unsigned Chunk>
+    __aie_inline
+    static vector<DataType, data_elems> load(const DataType *window)
+    {
+        constexpr unsigned first        = window_offset + Chunk * points;
+        constexpr unsigned num_granules = utils::ceildiv(data_start(Chunk) + Lanes + chunk_points(Chunk) - 1, granule);
+
+        vector<DataType, data_elems> data;
+
+        utils::unroll_times<num_granules>([&](unsigned g) __aie_inline {
+            data.insert(g, aie::load_v<granule>(window + (first / granule + g) * granule));
+        });
+
+        return data;
+    }
+
+    template <typename... Acc>
+    __aie_inline
+    static accum_type run(const coeff_storage &coeffs, const DataType *window, const Acc &...acc)
+    {
+        accum_type ret;
+
+        utils::unroll_times<chunks>([&](auto idx) __aie_inline {
+            constexpr unsigned chunk = idx;
+            constexpr unsigned tap   = chunk * points;
+
+            using mul_ops = fir_mul_ops<Lanes, chunk_points(chunk), CoeffType, DataType, AccumTag>;
+
+            const auto data = load<chunk>(window);
+
+            if constexpr (chunk == 0 && sizeof...(Acc) == 0)
+                ret = mul_ops::mul(coeffs[tap / coeff_elems], tap % coeff_elems, data, data_start(chunk));
+            else if constexpr (chunk == 0)
+                ret = mul_ops::mac(acc..., coeffs[tap / coeff_elems], tap % coeff_elems, data, data_start(chunk));
+            else
+                ret = mul_ops::mac(ret, coeffs[tap / coeff_elems], tap % coeff_elems, data, data_start(chunk));
+        });
+
+        return ret;
+    }
+
+    // Same as run, but the accumulation is kept in partial results, which avoids reshuffling complex accumulators in the
+    // architectures that compute their real and imaginary parts separately. A default-constructed partial result starts
+    // the accumulation from zero.
+    __aie_inline
+    static last_partial run_partial(const coeff_storage &coeffs, const DataType *window, first_partial partial)
+    {
+        utils::unroll_times<main_chunks>([&](auto idx) __aie_inline {
+            constexpr unsigned chunk = idx;
+            constexpr unsigned tap   = chunk * points;
+
+            partial.mac(coeffs[tap / coeff_elems], tap % coeff_elems, load<chunk>(window), data_start(chunk));
+        });
+
+        if constexpr (main_chunks == 0 || tail_points == 0) {
+            if constexpr (tail_points)
+                partial.mac(coeffs[0], 0, load<0>(window), data_start(0));
+
+            return partial;
+        }
+        else {
+            constexpr unsigned tap = main_chunks * points;
+
+            last_partial tail;
+
+            if constexpr (accum_type::is_complex())
+                tail = last_partial(partial.to_accum_components());
+            else
+                tail = last_partial(partial.to_accum());
+
+            tail.mac(coeffs[tap / coeff_elems], tap % coeff_elems, load<main_chunks>(window), data_start(main_chunks));
+
+            return tail;
+        }
+    }
+};
+
+template <typename T>
+static constexpr bool fir_is_mirror(T a, T b, bool negate)
+{
+    return negate? a == T(-b) : a == b;
+}
+
+// Returns whether coefficient i of a filter is equal to coefficient taps - 1 - i, or to its negation, for all i
+template <typename T>
+static constexpr bool fir_is_mirrored(const T *coeffs, unsigned taps, bool negate)
+{
+    for (unsigned i = 0; i < (taps + 1) / 2; ++i) {
+        const T &a = coeffs[i];
+        const T &b = coeffs[taps - 1 - i];
+
+        if constexpr (is_complex_v<T>) {
+            if (!fir_is_mirror(a.real, b.real, negate) || !fir_is_mirror(a.imag, b.imag, negate))
+                return false;
+        }
+        else {
+            if (!fir_is_mirror(a, b, negate))
+                return false;
+        }
+    }
+
+    return true;
+}
+
+// Number of coefficient pairs of the main chunks of a symmetric filter. Outer chunks read their left and right samples
+// from two data vectors of up to 512b, and the inner chunk of a filter with an odd number of taps reads both sides and
+// the centre tap from a single data vector of up to 1024b. Data is loaded in granules of 128b, as the data vectors are
+// too small to absorb the misalignment of 256b granules.
+static constexpr unsigned fir_sym_chunk_pairs(unsigned taps, unsigned lanes, unsigned native_pairs,
+                                              unsigned coeff_elems, unsigned data_bits, unsigned granule)
+{
+    const unsigned padded_pairs = utils::ceildiv(taps / 2, native_pairs) * native_pairs;
+    const unsigned max_pairs    = taps % 2? coeff_elems / 2 : coeff_elems;
+
+    unsigned pairs = native_pairs;
+
+    while (2 * pairs <= padded_pairs &&
+           2 * pairs <= max_pairs &&
+           fir_data_elems(lanes, 2 * pairs, granule) * data_bits <= 512 &&
+           (taps % 2 == 0 || fir_data_elems(lanes, 4 * pairs + 1, granule) * data_bits <= 1024))
+        pairs *= 2;
+
+    return pairs;
+}
+
+// Splits the taps of a symmetric or antisymmetric filter into symmetric sliding multiplications, in which each
+// coefficient multiplies the sum (or difference) of the two samples that share it. Each chunk covers the coefficient
+// pairs [t, t + q), which are applied to the samples t + i... of the window and to the mirrored samples Taps - 1 - t + i...
+//
+// If the number of taps is odd, the first chunk covers the innermost pairs and the centre tap with a single
+// multiplication of 2 * q + 1 points. The window needs guard blocks before it because the right samples of the outer
+// chunks are read from granules that may start before the window.
+template <unsigned Taps, unsigned Lanes, typename CoeffType, typename DataType, typename AccumTag, bool Antisym>
+struct fir_sym_chunks
+{
+    template <unsigned Points>
+    using mul_ops = sliding_mul_sym_ops<Lanes, Points, 1, 1, 1, CoeffType, DataType, AccumTag>;
+
+    using accum_type = accum<accum_tag_or_default_t<AccumTag, CoeffType, DataType>, Lanes>;
+
+    static constexpr unsigned data_bits    = type_bits_v<DataType>;
+    static constexpr unsigned native_pairs = mul_ops<32>::columns_per_mul;
+    static constexpr unsigned coeff_elems  = 256 / type_bits_v<CoeffType>;
+    static constexpr unsigned granule      = std::min(Lanes, 128 / data_bits);
+
+    static_assert(fir_data_elems(Lanes, native_pairs, granule) * data_bits <= 512 &&
+                  (Taps % 2 == 0 || fir_data_elems(Lanes, 2 * native_pairs + 1, granule) * data_bits <= 1024),
+                  "Lanes is too large for the given types");
+
+    static constexpr unsigned pairs          = fir_sym_chunk_pairs(Taps, Lanes, native_pairs, coeff_elems, data_bits, granule);
+    static constexpr bool     odd            = Taps % 2 == 1;
+    static constexpr unsigned inner_pairs    = !odd? 0 : (Taps / 2) % pairs? (Taps / 2) % pairs : std::min(pairs, Taps / 2);
+    static constexpr unsigned outer_start    = utils::ceildiv(inner_pairs + 1, pairs) * pairs;
+    static constexpr unsigned tail_pairs     = !odd && (Taps / 2) % pairs? utils::ceildiv((Taps / 2) % pairs, native_pairs) * native_pairs : 0;
+    static constexpr unsigned outer_chunks   = (Taps / 2 - inner_pairs) / pairs;
+    static constexpr unsigned chunks         = (odd? 1 : 0) + outer_chunks + (tail_pairs? 1 : 0);
+    static constexpr unsigned pair_elems     = fir_data_elems(Lanes, pairs, granule);
+    static constexpr unsigned inner_elems    = fir_data_elems(Lanes, 2 * pairs + 1, granule);
+    static constexpr unsigned coeff_size     = odd? (outer_chunks? outer_start + outer_chunks * pairs : inner_pairs + 1)
+                                                  : outer_chunks * pairs + tail_pairs;
+    static constexpr unsigned coeff_vectors  = utils::ceildiv(coeff_size, coeff_elems);
+    static constexpr unsigned history_blocks = utils::ceildiv(Taps - 1, Lanes);
+
+    // Position of the oldest sample used by the first output within the first block of the window
+    static constexpr int      window_offset  = history_blocks * Lanes - (Taps - 1);
+
+    // End of the pairs covered by the outer chunks. The right side of the last outer chunk reads the lowest positions of
+    // the window, which may be negative, and the granule that contains them
+    static constexpr unsigned outer_end      = outer_chunks * pairs + tail_pairs;
+    static constexpr int      lowest         = window_offset + int(Taps - outer_end);
+    static constexpr unsigned guard_blocks   = outer_end? utils::ceildiv(unsigned(std::max(0, -lowest)) + granule - 1, Lanes) : 0;
+
+    using coeff_storage = std::array<vector<CoeffType, coeff_elems>, coeff_vectors>;
+
+    struct chunk_desc
+    {
+        unsigned tap;
+        unsigned pairs;
+        unsigned coeff_pos;
+        bool     inner;
+    };
+
+    static constexpr chunk_desc chunk(unsigned c)
+    {
+        if (odd && c == 0)
+            return {Taps / 2 - inner_pairs, inner_pairs, 0, true};
+        else if (odd)
+            return {(c - 1) * pairs, pairs, outer_start + (c - 1) * pairs, false};
+        else if (c < outer_chunks)
+            return {c * pairs, pairs, c * pairs, false};
+        else
+            return {c * pairs, tail_pairs, c * pairs, false};
+    }
+
+    // Position i of the coefficient vectors holds the coefficient of the left tap of a pair, or the centre tap
+    static constexpr std::array<int, coeff_size> index()
+    {
+        std::array<int, coeff_size> ret{};
+
+        for (unsigned i = 0; i < coeff_size; ++i)
+            ret[i] = -1;
+
+        for (unsigned c = 0; c < chunks; ++c) {
+            const chunk_desc d = chunk(c);
+
+            for (unsigned j = 0; j < d.pairs + (d.inner? 1 : 0); ++j) {
+                if (d.tap + j < Taps / 2 || (d.inner && d.tap + j == Taps / 2))
+                    ret[d.coeff_pos + j] = d.tap + j;
+            }
+        }
+
+        return ret;
+    }
+
+    static coeff_storage make_coeffs(const CoeffType *coeffs)
+    {
+        return fir_make_coeffs<coeff_elems, coeff_vectors>(coeffs, index());
+    }
+
+    static constexpr int floor_granule(int x)
+    {
+        return x >= 0? x / int(granule) * int(granule) : -int(utils::ceildiv(unsigned(-x), granule) * granule);
+    }
+
+    // Loads the samples in positions [first, last] of the window, starting at the granule that contains first
+    template <unsigned Elems, int First, int Last>
+    __aie_inline
+    static vector<DataType, Elems> load(const DataType *window)
+    {
+        constexpr int      base         = floor_granule(First);
+        constexpr unsigned num_granules = utils::ceildiv(unsigned(Last + 1 - base), granule);
+
+        vector<DataType, Elems> ret;
+
+        utils::unroll_times<num_granules>([&](unsigned g) __aie_inline {
+            ret.insert(g, aie::load_v<granule>(window + base + int(g * granule)));
+        });
+
+        return ret;
+    }
+
+    template <unsigned Points, typename... Args>
+    __aie_inline
+    static accum_type mul(const Args &...args)
+    {
+        if constexpr (Antisym)
+            return mul_ops<Points>::mul_antisym(args...);
+        else
+            return mul_ops<Points>::mul_sym(args...);
+    }
+
+    template <unsigned Points, typename... Args>
+    __aie_inline
+    static accum_type mac(const Args &...args)
+    {
+        if constexpr (Antisym)
+            return mul_ops<Points>::mac_antisym(args...);
+        else
+            return mul_ops<Points>::mac_sym(args...);
+    }
+
+    template <typename... Acc>
+    __aie_inline
+    static accum_type run(const coeff_storage &coeffs, const DataType *window, const Acc &...acc)
+    {
+        accum_type ret;
+
+        utils::unroll_times<chunks>([&](auto idx) __aie_inline {
+            constexpr unsigned   c     = idx;
+            constexpr chunk_desc d     = chunk(c);
+            constexpr unsigned   cs    = d.coeff_pos % coeff_elems;
+            constexpr int        left  = window_offset + int(d.tap);
+            constexpr int        right = window_offset + int(Taps - 1 - d.tap);
+
+            const auto &cv = coeffs[d.coeff_pos / coeff_elems];
+
+            if constexpr (d.inner) {
+                constexpr unsigned points = 2 * d.pairs + 1;
+
+                const auto data = load<inner_elems, left, right + int(Lanes) - 1>(window);
+
+                constexpr unsigned ds = left - floor_granule(left);
+
+                if constexpr (sizeof...(Acc) == 0)
+                    ret = mul<points>(cv, cs, data, ds);
+                else
+                    ret = mac<points>(acc..., cv, cs, data, ds);
+            }
+            else {
+                constexpr unsigned points = 2 * d.pairs;
+
+                const auto ldata = load<pair_elems, left, left + int(d.pairs + Lanes) - 2>(window);
+                const auto rdata = load<pair_elems, right - int(d.pairs) + 1, right + int(Lanes) - 1>(window);
+
+                constexpr unsigned ls = left  - floor_granule(left);
+                constexpr unsigned rs = right - floor_granule(right - int(d.pairs) + 1);
+
+                if constexpr (c == 0 && sizeof...(Acc) == 0)
+                    ret = mul<points>(cv, cs, ldata, ls, rdata, rs);
+                else if constexpr (c == 0)
+                    ret = mac<points>(acc..., cv, cs, ldata, ls, rdata, rs);
+                else
+                    ret = mac<points>(ret, cv, cs, ldata, ls, rdata, rs);
+            }
+        });
+
+        return ret;
+    }
+};
+
+// History of the input of a filter. The delay line holds the last Taps - 1 samples (rounded up to a multiple of Lanes)
+// plus the newest block, and it is mirrored so that the window read by the filter is contiguous in memory. Each block is
+// written twice. Guard blocks before the delay line allow reading positions that precede the window.
+template <unsigned Taps, unsigned Lanes, typename DataType, unsigned Guard = 0>
+class fir_delay_line
+{
+    static constexpr unsigned window_blocks = utils::ceildiv(Taps - 1, Lanes) + 1;
+    static constexpr unsigned total_blocks  = Guard + 2 * window_blocks;
+
+public:
+    fir_delay_line()
+    {
+        reset();
+    }
+
+    void reset()
+    {
+        for (unsigned i = 0; i < total_blocks; ++i)
+            aie::store_v(delay_ + i * Lanes, aie::zeros<DataType, Lanes>());
+
+        pos_ = 0;
+    }
+
+    // Adds a block of samples and returns the window that ends with it
+    __aie_inline
+    const DataType *push(const vector<DataType, Lanes> &samples)
+    {
+        // The new block replaces the oldest one in the delay line and in its mirror
+        const unsigned slot = pos_ == 0? window_blocks - 1 : pos_ - 1;
+
+        aie::store_v(delay_ + (Guard + slot) * Lanes,                 samples);
+        aie::store_v(delay_ + (Guard + slot + window_blocks) * Lanes, samples);
+
+        const DataType *window = delay_ + (Guard + pos_) * Lanes;
+
+        pos_ = pos_ + 1 == window_blocks? 0 : pos_ + 1;
+
+        return window;
+    }
+
+private:
+    alignas(vector_decl_align) DataType delay_[total_blocks * Lanes];
+    unsigned pos_;
+};
+
+// Identity mapping of taps to coefficients
+template <unsigned Taps>
+static constexpr std::array<int, Taps> fir_index()
+{
+    std::array<int, Taps> ret{};
+
+    for (unsigned i = 0; i < Taps; ++i)
+        ret[i] = i;
+
+    return ret;
+}
+
+// Taps of each phase of a polyphase filter. Phase p of a decimator uses the taps p, p + Factor, p + 2 * Factor... of
+// the filter, and phase q of an interpolator uses the taps Factor - 1 - q, 2 * Factor - 1 - q... The filter is extended
+// with leading zero taps to a multiple of Factor, which does not change its output.
+template <unsigned Taps, unsigned Factor, bool Interpolation>
+static constexpr std::array<int, utils::ceildiv(Taps, Factor)> fir_polyphase_index(unsigned phase)
+{
+    constexpr unsigned phase_taps = utils::ceildiv(Taps, Factor);
+    constexpr unsigned padding    = phase_taps * Factor - Taps;
+
+    std::array<int, phase_taps> ret{};
+
+    for (unsigned j = 0; j < phase_taps; ++j) {
+        const unsigned tap = j * Factor + (Interpolation? Factor - 1 - phase : phase);
+
+        ret[j] = tap < padding? -1 : int(tap - padding);
+    }
+
+    return ret;
+}
+
+// Splits Factor consecutive blocks of samples into the Factor phases of the signal, so that phase p holds the samples
+// p, p + Factor, p + 2 * Factor...
+template <unsigned Factor, typename T, unsigned Elems>
+__aie_inline
+static std::array<vector<T, Elems>, Factor> fir_deinterleave(const std::array<vector<T, Elems>, Factor> &blocks)
+{
+    if constexpr (Factor == 1) {
+        return blocks;
+    }
+    else {
+        std::array<vector<T, Elems>, Factor / 2> even, odd;
+
+        utils::unroll_times<Factor / 2>([&](unsigned i) __aie_inline {
+            std::tie(even[i], odd[i]) = aie::interleave_unzip(blocks[2 * i], blocks[2 * i + 1], 1);
+        });
+
+        const auto even_phases = fir_deinterleave<Factor / 2>(even);
+        const auto  odd_phases = fir_deinterleave<Factor / 2>(odd);
+
+        std::array<vector<T, Elems>, Factor> ret;
+
+        utils::unroll_times<Factor / 2>([&](unsigned i) __aie_inline {
+            ret[2 * i]     = even_phases[i];
+            ret[2 * i + 1] =  odd_phases[i];
+        });
+
+        return ret;
+    }
+}
+
+// Inverse of fir_deinterleave
+template <unsigned Factor, typename T, unsigned Elems>
+__aie_inline
+static std::array<vector<T, Elems>, Factor> fir_interleave(const std::array<vector<T, Elems>, Factor> &phases)
+{
+    if constexpr (Factor == 1) {
+        return phases;
+    }
+    else {
+        std::array<vector<T, Elems>, Factor / 2> even_phases, odd_phases;
+
+        utils::unroll_times<Factor / 2>([&](unsigned i) __aie_inline {
+            even_phases[i] = phases[2 * i];
+             odd_phases[i] = phases[2 * i + 1];
+        });
+
+        const auto even = fir_interleave<Factor / 2>(even_phases);
+        const auto  odd = fir_interleave<Factor / 2>(odd_phases);
+
+        std::array<vector<T, Elems>, Factor> ret;
+
+        utils::unroll_times<Factor / 2>([&](unsigned i) __aie_inline {
+            std::tie(ret[2 * i], ret[2 * i + 1]) = aie::interleave_zip(even[i], odd[i], 1);
+        });
+
+        return ret;
+    }
+}
+
+} // namespace detail
+
+/**
+ * @ingroup group_mul_special
+ *
+ * Streaming FIR filter with an arbitrary number of taps, built on top of sliding_mul_ops.
+ *
+ * Each call to filter consumes a block of Lanes input samples and produces the Lanes outputs that correspond to them:
+ *
+ * @code
+ * out[n] = coeff[0] * in[n - Taps + 1] + coeff[1] * in[n - Taps + 2] + ... + coeff[Taps - 1] * in[n]
+ * @endcode
+ *
+ * The last Taps - 1 samples are kept in the object, so consecutive calls (and consecutive calls to run) filter a
+ * continuous stream without the caller having to provide margins. To implement the convolution with an impulse response
+ * h (out[n] = h[0] * in[n] + h[1] * in[n - 1] + ...), the coefficients must be given in reverse order.
+ *
+ * The taps are split into chunks that are computed with sliding_mul_ops::mul and sliding_mul_ops::mac. All chunks but
+ * the last one have @ref points taps, which is the largest multiple of the native points of the target architecture
+ * that fits in the coefficient and data vectors. The last chunk covers the remaining taps rounded up to the native
+ * points, so the number of multiplications that are wasted on zero-padded taps is the minimum possible for the target
+ * architecture, regardless of the number of taps.
+ *
+ * The history is stored in a delay line of Taps - 1 samples (rounded up to a multiple of Lanes) plus one block, which
+ * is mirrored so that the samples read by each chunk are contiguous in memory. Each block of input samples is written
+ * to the delay line twice.
+ *
+ * @code
+ * aie::fir<64, 16, int16, int16> f(coeffs);
+ *
+ * // Filters two consecutive frames of a continuous signal
+ * f.run(in0, out0, frame_size, shift);
+ * f.run(in1, out1, frame_size, shift);
+ * @endcode
+ *
+ * @tparam Taps      Number of coefficients of the filter.
+ * @tparam Lanes     Number of outputs computed in each call to filter. It must be a native number of lanes of
+ *                   sliding_mul_ops for the given types, or a multiple of it.
+ * @tparam CoeffType Type of the coefficients.
+ * @tparam DataType  Type of the data samples.
+ * @tparam AccumTag  Accumulator tag used for the multiplications.
+ */
+template <unsigned Taps, unsigned Lanes, ElemBaseType CoeffType, ElemBaseType DataType,
+          AccumElemBaseType AccumTag = detail::default_accum_tag_t<CoeffType, DataType>>
+    requires(Taps > 0 && is_valid_mul_op_v<CoeffType, DataType> && Lanes * detail::type_bits_v<DataType> >= 128)
+class fir
+{
+    using chunks_type = detail::fir_chunks<Taps, Lanes, CoeffType, DataType, AccumTag>;
+
+public:
+    /** Number of coefficients of the filter */
+    static constexpr unsigned taps        = Taps;
+    /** Number of outputs computed in each call to filter */
+    static constexpr unsigned lanes       = Lanes;
+    /** Number of taps of the main chunks */
+    static constexpr unsigned points      = chunks_type::points;
+    /** Number of points of the last chunk, which covers the taps that do not fill a main chunk. Zero if there is none */
+    static constexpr unsigned tail_points = chunks_type::tail_points;
+    /** Number of sliding multiplications in each call to filter */
+    static constexpr unsigned chunks      = chunks_type::chunks;
+
+    using accum_type = typename chunks_type::accum_type;
+
+    /**
+     * Creates a filter with the given coefficients and a history of zeros.
+     *
+     * @param coeffs Pointer to Taps coefficients. It does not need to be aligned.
+     */
+    explicit fir(const CoeffType *coeffs) :
+        coeffs_(chunks_type::make_coeffs(coeffs, detail::fir_index<Taps>()))
+    {
+    }
+
+    /**
+     * Clears the history of the filter, as if all the previous samples were zero.
+     */
+    void reset()
+    {
+        delay_line_.reset();
+    }
+
+    /**
+     * Consumes a block of input samples and returns the accumulated outputs that correspond to them.
+     *
+     * @param samples Block of Lanes input samples.
+     */
+    __aie_inline
+    accum_type filter(const vector<DataType, Lanes> &samples)
+    {
+        return chunks_type::run(coeffs_, delay_line_.push(samples));
+    }
+
+    /**
+     * Filters a block of samples and writes the outputs, converted to OutType.
+     *
+     * @param in    Input samples.
+     * @param out   Output samples.
+     * @param n     Number of samples. It must be a multiple of Lanes.
+     * @param shift Shift applied to the accumulated outputs when they are converted to OutType.
+     */
+    template <ElemBaseType OutType>
+    void run(const DataType * __restrict in, OutType * __restrict out, unsigned n, int shift = 0)
+    {
+        for (unsigned i = 0; i < n / Lanes; ++i)
+            chess_prepare_for_pipelining
+        {
+            const accum_type acc = filter(load_v<Lanes>(in + i * Lanes));
+
+            store_v(out + i * Lanes, acc.template to_vector<OutType>(shift));
+        }
+    }
+
+private:
+    typename chunks_type::coeff_storage           coeffs_;
+    detail::fir_delay_line<Taps, Lanes, DataType> delay_line_;
+};
+
+/**
+ * @ingroup group_mul_special
+ *
+ * Streaming FIR filter that decimates its output by a factor of Decimation. It computes the outputs of @ref fir at
+ * positions Decimation - 1, 2 * Decimation - 1...:
+ *
+ * @code
+ * out[m] = coeff[0] * in[m * Decimation + Decimation - Taps] + ... + coeff[Taps - 1] * in[m * Decimation + Decimation - 1]
+ * @endcode
+ *
+ * The filter is implemented as a polyphase filter. The input is split into Decimation phases, each of them filtered by
+ * a sub-filter with every Decimation-th coefficient, and the results of all phases are accumulated together. Only the
+ * outputs that are kept are computed, so the number of multiplications per input sample is divided by Decimation with
+ * respect to filtering at the input rate and discarding outputs. The split of the coefficients into phases is computed
+ * at compile time.
+ *
+ * @tparam Taps       Number of coefficients of the filter.
+ * @tparam Decimation Decimation factor. It must be a power of two.
+ * @tparam Lanes      Number of outputs computed in each call to filter.
+ * @tparam CoeffType  Type of the coefficients.
+ * @tparam DataType   Type of the data samples.
+ * @tparam AccumTag   Accumulator tag used for the multiplications.
+ */
+template <unsigned Taps, unsigned Decimation, unsigned Lanes, ElemBaseType CoeffType, ElemBaseType DataType,
+          AccumElemBaseType AccumTag = detail::default_accum_tag_t<CoeffType, DataType>>
+    requires(Taps > 0 && detail::utils::is_powerof2(Decimation) &&
+             is_valid_mul_op_v<CoeffType, DataType> && Lanes * detail::type_bits_v<DataType> >= 128)
+class fir_decimator
+{
+    static constexpr unsigned phase_taps = detail::utils::ceildiv(Taps, Decimation);
+
+    using chunks_type = detail::fir_chunks<phase_taps, Lanes, CoeffType, DataType, AccumTag>;
+
+public:
+    /** Number of coefficients of the filter */
+    static constexpr unsigned taps       = Taps;
+    /** Decimation factor */
+    static constexpr unsigned decimation = Decimation;
+    /** Number of outputs computed in each call to filter */
+    static constexpr unsigned lanes      = Lanes;
+
+    using accum_type = typename chunks_type::accum_type;
+
+    /**
+     * Creates a filter with the given coefficients and a history of zeros.
+     *
+     * @param coeffs Pointer to Taps coefficients. It does not need to be aligned.
+     */
+    explicit fir_decimator(const CoeffType *coeffs)
+    {
+        detail::utils::unroll_times<Decimation>([&](auto p) {
+            constexpr auto index = detail::fir_polyphase_index<Taps, Decimation, false>(p);
+
+            coeffs_[p] = chunks_type::make_coeffs(coeffs, index);
+        });
+    }
+
+    /**
+     * Clears the history of the filter, as if all the previous samples were zero.
+     */
+    void reset()
+    {
+        for (auto &delay_line : delay_lines_)
+            delay_line.reset();
+    }
+
+    /**
+     * Consumes Lanes * Decimation input samples and returns the Lanes accumulated outputs that correspond to them.
+     *
+     * @param in Input samples. It must be aligned to the size of a vector of Lanes samples.
+     */
+    __aie_inline
+    accum_type filter(const DataType *in)
+    {
+        std::array<vector<DataType, Lanes>, Decimation> blocks;
+
+        detail::utils::unroll_times<Decimation>([&](unsigned i) __aie_inline {
+            blocks[i] = load_v<Lanes>(in + i * Lanes);
+        });
+
+        const auto phases = detail::fir_deinterleave<Decimation>(blocks);
+
+        accum_type acc;
+
+        detail::utils::unroll_times<Decimation>([&](auto p) __aie_inline {
+            const DataType *window = delay_lines_[p].push(phases[p]);
+
+            if constexpr (p == 0)
+                acc = chunks_type::run(coeffs_[p], window);
+            else
+                acc = chunks_type::run(coeffs_[p], window, acc);
+        });
+
+        return acc;
+    }
+
+    /**
+     * Filters a block of samples and writes the decimated outputs, converted to OutType.
+     *
+     * @param in    Input samples.
+     * @param out   Output samples. n / Decimation samples are written.
+     * @param n     Number of input samples. It must be a multiple of Lanes * Decimation.
+     * @param shift Shift applied to the accumulated outputs when they are converted to OutType.
+     */
+    template <ElemBaseType OutType>
+    void run(const DataType * __restrict in, OutType * __restrict out, unsigned n, int shift = 0)
+    {
+        for (unsigned i = 0; i < n / (Lanes * Decimation); ++i)
+            chess_prepare_for_pipelining
+        {
+            const accum_type acc = filter(in + i * Lanes * Decimation);
+
+            store_v(out + i * Lanes, acc.template to_vector<OutType>(shift));
+        }
+    }
+
+private:
+    std::array<typename chunks_type::coeff_storage, Decimation>                  coeffs_;
+    std::array<detail::fir_delay_line<phase_taps, Lanes, DataType>, Decimation> delay_lines_;
+};
+
+/**
+ * @ingroup group_mul_special
+ *
+ * Streaming FIR filter that interpolates its input by a factor of Interpolation. It computes the output of @ref fir
+ * over the input upsampled with Interpolation - 1 zeros after each sample:
+ *
+ * @code
+ * up[n]  = n % Interpolation == 0? in[n / Interpolation] : 0
+ * out[n] = coeff[0] * up[n - Taps + 1] + coeff[1] * up[n - Taps + 2] + ... + coeff[Taps - 1] * up[n]
+ * @endcode
+ *
+ * The filter is implemented as a polyphase filter. Each phase of the output is computed by a sub-filter with every
+ * Interpolation-th coefficient over the same input history, and the phases are interleaved when the outputs are
+ * written. The multiplications by the inserted zeros are not computed, which divides the number of multiplications per
+ * output sample by Interpolation. The split of the coefficients into phases is computed at compile time.
+ *
+ * @tparam Taps          Number of coefficients of the filter.
+ * @tparam Interpolation Interpolation factor. It must be a power of two.
+ * @tparam Lanes         Number of input samples consumed in each call to filter.
+ * @tparam CoeffType     Type of the coefficients.
+ * @tparam DataType      Type of the data samples.
+ * @tparam AccumTag      Accumulator tag used for the multiplications.
+ */
+template <unsigned Taps, unsigned Interpolation, unsigned Lanes, ElemBaseType CoeffType, ElemBaseType DataType,
+          AccumElemBaseType AccumTag = detail::default_accum_tag_t<CoeffType, DataType>>
+    requires(Taps > 0 && detail::utils::is_powerof2(Interpolation) &&
+             is_valid_mul_op_v<CoeffType, DataType> && Lanes * detail::type_bits_v<DataType> >= 128)
+class fir_interpolator
+{
+    static constexpr unsigned phase_taps = detail::utils::ceildiv(Taps, Interpolation);
+
+    using chunks_type = detail::fir_chunks<phase_taps, Lanes, CoeffType, DataType, AccumTag>;
+
+public:
+    /** Number of coefficients of the filter */
+    static constexpr unsigned taps          = Taps;
+    /** Interpolation factor */
+    static constexpr unsigned interpolation = Interpolation;
+    /** Number of input samples consumed in each call to filter */
+    static constexpr unsigned lanes         = Lanes;
+
+    using accum_type = typename chunks_type::accum_type;
+
+    /**
+     * Creates a filter with the given coefficients and a history of zeros.
+     *
+     * @param coeffs Pointer to Taps coefficients. It does not need to be aligned.
+     */
+    explicit fir_interpolator(const CoeffType *coeffs)
+    {
+        detail::utils::unroll_times<Interpolation>([&](auto q) {
+            constexpr auto index = detail::fir_polyphase_index<Taps, Interpolation, true>(q);
+
+            coeffs_[q] = chunks_type::make_coeffs(coeffs, index);
+        });
+    }
+
+    /**
+     * Clears the history of the filter, as if all the previous samples were zero.
+     */
+    void reset()
+    {
+        delay_line_.reset();
+    }
+
+    /**
+     * Consumes a block of input samples and returns the accumulated outputs of each phase. Element i of phase q is the
+     * output i * Interpolation + q of the block.
+     *
+     * @param samples Block of Lanes input samples.
+     */
+    __aie_inline
+    std::array<accum_type, Interpolation> filter(const vector<DataType, Lanes> &samples)
+    {
+        const DataType *window = delay_line_.push(samples);
+
+        std::array<accum_type, Interpolation> ret;
+
+        detail::utils::unroll_times<Interpolation>([&](unsigned q) __aie_inline {
+            ret[q] = chunks_type::run(coeffs_[q], window);
+        });
+
+        return ret;
+    }
+
+    /**
+     * Filters a block of samples and writes the interpolated outputs, converted to OutType.
+     *
+     * @param in    Input samples.
+     * @param out   Output samples. n * Interpolation samples are written.
+     * @param n     Number of input samples. It must be a multiple of Lanes.
+     * @param shift Shift applied to the accumulated outputs when they are converted to OutType.
+     */
+    template <ElemBaseType OutType>
+    void run(const DataType * __restrict in, OutType * __restrict out, unsigned n, int shift = 0)
+    {
+        for (unsigned i = 0; i < n / Lanes; ++i)
+            chess_prepare_for_pipelining
+        {
+            const std::array<accum_type, Interpolation> acc = filter(load_v<Lanes>(in + i * Lanes));
+
+            std::array<vector<OutType, Lanes>, Interpolation> phases;
+
+            detail::utils::unroll_times<Interpolation>([&](unsigned q) __aie_inline {
+                phases[q] = acc[q].template to_vector<OutType>(shift);
+            });
+
+            const auto blocks = detail::fir_interleave<Interpolation>(phases);
+
+            detail::utils::unroll_times<Interpolation>([&](unsigned q) __aie_inline {
+                store_v(out + (i * Interpolation + q) * Lanes, blocks[q]);
+            });
+        }
+    }
+
+private:
+    std::array<typename chunks_type::coeff_storage, Interpolation> coeffs_;
+    detail::fir_delay_line<phase_taps, Lanes, DataType>            delay_line_;
+};
+
+/**
+ * @ingroup group_mul_special
+ *
+ * Slice of a streaming FIR filter that is split across a chain of Tiles kernels connected by cascade streams. Each
+ * kernel is an instance of this class with its position Tile in the chain, and all kernels receive the same input
+ * samples. Together they compute the same outputs as @ref fir:
+ *
+ * - Kernel Tile computes the taps [first_tap, first_tap + slice_taps) of the filter. All slices but the last one have
+ *   the same number of taps, which is a multiple of the native points of the target architecture, so that only the
+ *   last slice contains zero-padded taps.
+ * - The taps of a slice are applied to the input delayed by data_offset samples, which is the number of taps that
+ *   follow the slice. The delay is kept in the delay line of the kernel.
+ * - The first kernel starts the accumulation, the following kernels read the partial results from their input cascade
+ *   and add their slice to them, and all kernels but the last one write the partial results to their output cascade.
+ *   The last kernel converts the accumulated outputs and writes them to memory.
+ *
+ * Partial results are passed between kernels as partial_sliding_mul values, so that the architectures that compute
+ * the real and imaginary parts of complex accumulators separately do not reshuffle them in every kernel. The
+ * multiplications of each kernel are split into chunks in the same way as in @ref fir.
+ *
+ * @code
+ * using fir_t = aie::cascade_fir<512, 4, Tile, 16, cint16, cint16, cacc64>;
+ *
+ * // Kernel in the middle of the chain
+ * void kernel(const cint16 *in, input_cascade<cacc64> &cin, output_cascade<cacc64> &cout)
+ * {
+ *     static fir_t fir(coeffs);
+ *
+ *     fir.run(in, cin, cout, frame_size);
+ * }
+ * @endcode
+ *
+ * @tparam Taps      Number of coefficients of the whole filter.
+ * @tparam Tiles     Number of kernels in the chain.
+ * @tparam Tile      Position of this kernel in the chain, starting from zero.
+ * @tparam Lanes     Number of outputs computed in each call to filter.
+ * @tparam CoeffType Type of the coefficients.
+ * @tparam DataType  Type of the data samples.
+ * @tparam AccumTag  Accumulator tag used for the multiplications and the cascade streams.
+ */
+template <unsigned Taps, unsigned Tiles, unsigned Tile, unsigned Lanes, ElemBaseType CoeffType, ElemBaseType DataType,
+          AccumElemBaseType AccumTag = detail::default_accum_tag_t<CoeffType, DataType>>
+    requires(Taps > 0 && Tile < Tiles &&
+             is_valid_mul_op_v<CoeffType, DataType> && Lanes * detail::type_bits_v<DataType> >= 128)
+class cascade_fir
+{
+    static constexpr unsigned native_points = detail::fir_native_points<Lanes, CoeffType, DataType, AccumTag>;
+    static constexpr unsigned max_slice     = detail::utils::ceildiv(detail::utils::ceildiv(Taps, Tiles), native_points) * native_points;
+
+    static_assert((Tiles - 1) * max_slice < Taps, "Too many tiles for the number of taps");
+
+public:
+    /** Number of coefficients of the whole filter */
+    static constexpr unsigned taps           = Taps;
+    /** Number of kernels in the chain */
+    static constexpr unsigned tiles          = Tiles;
+    /** Position of this kernel in the chain */
+    static constexpr unsigned tile           = Tile;
+    /** Number of outputs computed in each call to filter */
+    static constexpr unsigned lanes          = Lanes;
+    /** First tap of the filter computed by this kernel */
+    static constexpr unsigned first_tap      = Tile * max_slice;
+    /** Number of taps computed by this kernel */
+    static constexpr unsigned slice_taps     = std::min(max_slice, Taps - first_tap);
+    /** Delay applied to the input samples of this kernel */
+    static constexpr unsigned data_offset    = Taps - first_tap - slice_taps;
+    /** Whether this kernel reads partial results from an input cascade */
+    static constexpr bool     reads_cascade  = Tile > 0;
+    /** Whether this kernel writes partial results to an output cascade */
+    static constexpr bool     writes_cascade = Tile + 1 < Tiles;
+
+private:
+    using chunks_type = detail::fir_chunks<slice_taps, Lanes, CoeffType, DataType, AccumTag, data_offset>;
+
+public:
+    using accum_type = typename chunks_type::accum_type;
+
+    /** Type of the partial results read from the input cascade */
+    using input_partial_type  = typename chunks_type::first_partial;
+    /** Type of the partial results computed by this kernel */
+    using output_partial_type = typename chunks_type::last_partial;
+
+    /**
+     * Creates the slice of the filter that corresponds to this kernel, with a history of zeros.
+     *
+     * @param coeffs Pointer to the Taps coefficients of the whole filter. It does not need to be aligned.
+     */
+    explicit cascade_fir(const CoeffType *coeffs) :
+        coeffs_(chunks_type::make_coeffs(coeffs + first_tap, detail::fir_index<slice_taps>()))
+    {
+    }
+
+    /**
+     * Clears the history of the filter, as if all the previous samples were zero.
+     */
+    void reset()
+    {
+        delay_line_.reset();
+    }
+
+    /**
+     * Consumes a block of input samples and returns the partial results of this kernel, added to the given ones.
+     *
+     * @param samples Block of Lanes input samples.
+     * @param partial Partial results of the previous kernels. A default-constructed value starts the accumulation.
+     */
+    __aie_inline
+    output_partial_type filter(const vector<DataType, Lanes> &samples, const input_partial_type &partial = {})
+    {
+        return chunks_type::run_partial(coeffs_, delay_line_.push(samples), partial);
+    }
+
+    /**
+     * Filters a block of samples in the first kernel of a chain and writes the partial results to the output cascade.
+     *
+     * @param in   Input samples.
+     * @param cout Output cascade.
+     * @param n    Number of samples. It must be a multiple of Lanes.
+     */
+    void run(const DataType * __restrict in, output_cascade<AccumTag, void> &cout, unsigned n)
+        requires(!reads_cascade && writes_cascade)
+    {
+        for (unsigned i = 0; i < n / Lanes; ++i)
+            chess_prepare_for_pipelining
+        {
+            cout << filter(load_v<Lanes>(in + i * Lanes));
+        }
+    }
+
+    /**
+     * Filters a block of samples in a kernel in the middle of a chain. The partial results are read from the input
+     * cascade and written to the output cascade.
+     *
+     * @param in   Input samples.
+     * @param cin  Input cascade.
+     * @param cout Output cascade.
+     * @param n    Number of samples. It must be a multiple of Lanes.
+     */
+    void run(const DataType * __restrict in, input_cascade<AccumTag, void> &cin, output_cascade<AccumTag, void> &cout, unsigned n)
+        requires(reads_cascade && writes_cascade)
+    {
+        for (unsigned i = 0; i < n / Lanes; ++i)
+            chess_prepare_for_pipelining
+        {
+            input_partial_type partial;
+            cin >> partial;
+
+            cout << filter(load_v<Lanes>(in + i * Lanes), partial);
+        }
+    }
+
+    /**
+     * Filters a block of samples in the last kernel of a chain. The partial results are read from the input cascade,
+     * and the outputs are converted to OutType and written to memory.
+     *
+     * @param in    Input samples.
+     * @param cin   Input cascade.
+     * @param out   Output samples.
+     * @param n     Number of samples. It must be a multiple of Lanes.
+     * @param shift Shift applied to the accumulated outputs when they are converted to OutType.
+     */
+    template <ElemBaseType OutType>
+    void run(const DataType * __restrict in, input_cascade<AccumTag, void> &cin, OutType * __restrict out, unsigned n, int shift = 0)
+        requires(reads_cascade && !writes_cascade)
+    {
+        for (unsigned i = 0; i < n / Lanes; ++i)
+            chess_prepare_for_pipelining
+        {
+            input_partial_type partial;
+            cin >> partial;
+
+            store_v(out + i * Lanes, filter(load_v<Lanes>(in + i * Lanes), partial).template to_vector<OutType>(shift));
+        }
+    }
+
+    /**
+     * Filters a block of samples in a chain of a single kernel, which computes the whole filter.
+     *
+     * @param in    Input samples.
+     * @param out   Output samples.
+     * @param n     Number of samples. It must be a multiple of Lanes.
+     * @param shift Shift applied to the accumulated outputs when they are converted to OutType.
+     */
+    template <ElemBaseType OutType>
+    void run(const DataType * __restrict in, OutType * __restrict out, unsigned n, int shift = 0)
+        requires(!reads_cascade && !writes_cascade)
+    {
+        for (unsigned i = 0; i < n / Lanes; ++i)
+            chess_prepare_for_pipelining
+        {
+            store_v(out + i * Lanes, filter(load_v<Lanes>(in + i * Lanes)).template to_vector<OutType>(shift));
+        }
+    }
+
+private:
+    typename chunks_type::coeff_storage                               coeffs_;
+    detail::fir_delay_line<slice_taps + data_offset, Lanes, DataType> delay_line_;
+};
+
+/**
+ * @ingroup group_mul_special
+ *
+ * Symmetry of the coefficients of a FIR filter.
+ */
+enum class fir_symmetry
+{
+    /** The coefficients have no symmetry */
+    none,
+    /** coeff[i] == coeff[Taps - 1 - i] */
+    symmetric,
+    /** coeff[i] == -coeff[Taps - 1 - i]. If the number of taps is odd, the centre tap is zero */
+    antisymmetric,
+};
+
+/**
+ * @ingroup group_mul_special
+ *
+ * Returns the symmetry of a set of coefficients. Coefficients that are both symmetric and antisymmetric (all zeros)
+ * are reported as symmetric. It can be used in constant expressions.
+ *
+ * @param coeffs Pointer to the coefficients.
+ * @param taps   Number of coefficients.
+ */
+template <ElemBaseType CoeffType>
+constexpr fir_symmetry fir_symmetry_of(const CoeffType *coeffs, unsigned taps)
+{
+    if (taps < 2)
+        return fir_symmetry::none;
+    else if (detail::fir_is_mirrored(coeffs, taps, false))
+        return fir_symmetry::symmetric;
+    else if (detail::fir_is_mirrored(coeffs, taps, true))
+        return fir_symmetry::antisymmetric;
+    else
+        return fir_symmetry::none;
+}
+
+/**
+ * @ingroup group_mul_special
+ *
+ * Streaming FIR filter with symmetric or antisymmetric coefficients. It computes the same outputs as @ref fir, but each
+ * coefficient is applied once to the sum (or difference) of the two samples that share it, using
+ * sliding_mul_sym_ops::mul_sym and sliding_mul_sym_ops::mul_antisym. This halves the number of multiplications and
+ * coefficients with respect to @ref fir.
+ *
+ * If the number of taps is odd, the innermost pairs and the centre tap are computed together by a single symmetric
+ * multiplication with an odd number of points, in which the centre tap multiplies a single sample. The remaining pairs
+ * are split into chunks that read their left and right samples from two separate data vectors.
+ *
+ * This filter is only available on AIE, which is the only architecture with symmetric multiplications. aie::fir_for
+ * selects this filter or @ref fir depending on the coefficients and the target architecture.
+ *
+ * @tparam Taps      Number of coefficients of the filter.
+ * @tparam Lanes     Number of outputs computed in each call to filter.
+ * @tparam CoeffType Type of the coefficients.
+ * @tparam DataType  Type of the data samples.
+ * @tparam Symmetry  Symmetry of the coefficients.
+ * @tparam AccumTag  Accumulator tag used for the multiplications.
+ */
+template <unsigned Taps, unsigned Lanes, ElemBaseType CoeffType, ElemBaseType DataType, fir_symmetry Symmetry,
+          AccumElemBaseType AccumTag = detail::default_accum_tag_t<CoeffType, DataType>>
+    requires(arch::is(arch::AIE) && Taps >= 2 && Symmetry != fir_symmetry::none &&
+             is_valid_mul_op_v<CoeffType, DataType> && Lanes * detail::type_bits_v<DataType> >= 128)
+class fir_sym
+{
+    using chunks_type = detail::fir_sym_chunks<Taps, Lanes, CoeffType, DataType, AccumTag,
+                                               Symmetry == fir_symmetry::antisymmetric>;
+
+public:
+    /** Number of coefficients of the filter */
+    static constexpr unsigned     taps     = Taps;
+    /** Number of outputs computed in each call to filter */
+    static constexpr unsigned     lanes    = Lanes;
+    /** Symmetry of the coefficients */
+    static constexpr fir_symmetry symmetry = Symmetry;
+    /** Number of coefficient pairs of the main chunks */
+    static constexpr unsigned     pairs    = chunks_type::pairs;
+    /** Number of symmetric sliding multiplications in each call to filter */
+    static constexpr unsigned     chunks   = chunks_type::chunks;
+
+    using accum_type = typename chunks_type::accum_type;
+
+    /**
+     * Creates a filter with the given coefficients and a history of zeros. Only the first half of the coefficients
+     * (and the centre tap) is read, and the coefficients must have the given symmetry.
+     *
+     * @param coeffs Pointer to Taps coefficients. It does not need to be aligned.
+     */
+    explicit fir_sym(const CoeffType *coeffs) :
+        coeffs_(chunks_type::make_coeffs(coeffs))
+    {
+        REQUIRES_MSG(detail::fir_is_mirrored(coeffs, Taps, Symmetry == fir_symmetry::antisymmetric),
+                     "The coefficients do not have the requested symmetry");
+    }
+
+    /**
+     * Clears the history of the filter, as if all the previous samples were zero.
+     */
+    void reset()
+    {
+        delay_line_.reset();
+    }
+
+    /**
+     * Consumes a block of input samples and returns the accumulated outputs that correspond to them.
+     *
+     * @param samples Block of Lanes input samples.
+     */
+    __aie_inline
+    accum_type filter(const vector<DataType, Lanes> &samples)
+    {
+        return chunks_type::run(coeffs_, delay_line_.push(samples));
+    }
+
+    /**
+     * Filters a block of samples and writes the outputs, converted to OutType.
+     *
+     * @param in    Input samples.
+     * @param out   Output samples.
+     * @param n     Number of samples. It must be a multiple of Lanes.
+     * @param shift Shift applied to the accumulated outputs when they are converted to OutType.
+     */
+    template <ElemBaseType OutType>
+    void run(const DataType * __restrict in, OutType * __restrict out, unsigned n, int shift = 0)
+    {
+        for (unsigned i = 0; i < n / Lanes; ++i)
+            chess_prepare_for_pipelining
+        {
+            const accum_type acc = filter(load_v<Lanes>(in + i * Lanes));
+
+            store_v(out + i * Lanes, acc.template to_vector<OutType>(shift));
+        }
+    }
+
+private:
+    typename chunks_type::coeff_storage                                       coeffs_;
+    detail::fir_delay_line<Taps, Lanes, DataType, chunks_type::guard_blocks> delay_line_;
+};
+
+namespace detail {
+
+template <const auto &Coeffs>
+using fir_coeff_type_t = typename std::remove_cvref_t<decltype(Coeffs)>::value_type;
+
+template <const auto &Coeffs, unsigned Lanes, typename DataType, typename AccumTag>
+static constexpr auto fir_for_type()
+{
+    using coeff_type = fir_coeff_type_t<Coeffs>;
+
+    constexpr unsigned     taps     = Coeffs.size();
+    constexpr fir_symmetry symmetry = fir_symmetry_of(Coeffs.data(), taps);
+
+    if constexpr (arch::is(arch::AIE) && symmetry != fir_symmetry::none)
+        return std::type_identity<fir_sym<taps, Lanes, coeff_type, DataType, symmetry, AccumTag>>{};
+    else
+        return std::type_identity<fir<taps, Lanes, coeff_type, DataType, AccumTag>>{};
+}
+
+} // namespace detail
+
+/**
+ * @ingroup group_mul_special
+ *
+ * Streaming FIR filter for a set of coefficients known at compile time. The symmetry of the coefficients is detected
+ * at compile time: symmetric and antisymmetric filters are folded into @ref fir_sym on AIE, and all other filters (and
+ * all filters on the architectures without symmetric multiplications) use @ref fir.
+ *
+ * @code
+ * static constexpr std::array<int16, 31> coeffs = { ... };
+ *
+ * aie::fir_for<coeffs, 16, int16> f(coeffs.data());
+ * @endcode
+ *
+ * @tparam Coeffs   A constexpr std::array with static storage duration that holds the coefficients.
+ * @tparam Lanes    Number of outputs computed in each call to filter.
+ * @tparam DataType Type of the data samples.
+ * @tparam AccumTag Accumulator tag used for the multiplications.
+ */
+template <const auto &Coeffs, unsigned Lanes, ElemBaseType DataType,
+          AccumElemBaseType AccumTag = detail::default_accum_tag_t<detail::fir_coeff_type_t<Coeffs>, DataType>>
+using fir_for = typename decltype(detail::fir_for_type<Coeffs, Lanes, DataType, AccumTag>())::type;
+
+/**
+ * @ingroup group_mul_special
+ *
+ * Returns the streaming FIR filter selected by aie::fir_for for a set of coefficients known at compile time.
+ *
+ * @tparam Coeffs   A constexpr std::array with static storage duration that holds the coefficients.
+ * @tparam Lanes    Number of outputs computed in each call to filter.
+ * @tparam DataType Type of the data samples.
+ * @tparam AccumTag Accumulator tag used for the multiplications.
+ */
+template <const auto &Coeffs, unsigned Lanes, ElemBaseType DataType,
+          AccumElemBaseType AccumTag = detail::default_accum_tag_t<detail::fir_coeff_type_t<Coeffs>, DataType>>
+fir_for<Coeffs, Lanes, DataType, AccumTag> make_fir()
+{
+    return fir_for<Coeffs, Lanes, DataType, AccumTag>(Coeffs.data());
+}
+
+/**
+ * @ingroup group_mul_special
+ *
+ * Detection reported by @ref correlator.
+ */
+template <typename MagType>
+struct correlator_hit
+{
+    /** Index of the input sample that completes the match, counted from the last reset. The matched samples start at
+     *  index - Taps + 1 */
+    unsigned index;
+    /** Squared magnitude of the correlation */
+    MagType  magnitude;
+};
+
+/**
+ * @ingroup group_mul_special
+ *
+ * Streaming correlator that searches a complex signal for a reference sequence, such as a preamble. For each input
+ * sample it computes the squared magnitude of the correlation of the last Taps samples with the reference:
+ *
+ * @code
+ * corr[n] = conj(ref[0]) * in[n - Taps + 1] + conj(ref[1]) * in[n - Taps + 2] + ... + conj(ref[Taps - 1]) * in[n]
+ * mag[n]  = abs_square(corr[n])
+ * @endcode
+ *
+ * The correlation is computed as a @ref fir with the conjugated reference, and the magnitudes are compared as they are
+ * computed, so the correlation of the whole signal is never written to memory and no second pass over it is needed:
+ *
+ * - run writes only the samples whose magnitude is greater than or equal to a threshold, as (index, magnitude) hits.
+ * - The position and magnitude of the largest correlation since the last reset are tracked per lane with max_cmp, and
+ *   are reduced by peak.
+ *
+ * @code
+ * aie::correlator<64, 8, cint16, cint16> corr(preamble);
+ *
+ * aie::correlator_hit<int32> hits[16];
+ * unsigned num_hits = corr.run(in, frame_size, threshold, hits, 16, shift);
+ *
+ * aie::correlator_hit<int32> peak = corr.peak();
+ * @endcode
+ *
+ * @tparam Taps     Number of samples of the reference sequence.
+ * @tparam Lanes    Number of input samples consumed in each step.
+ * @tparam RefType  Type of the reference samples. It must be complex.
+ * @tparam DataType Type of the input samples. It must be complex.
+ * @tparam MagType  Type of the magnitudes, int32 or int16. The correlation is converted to the complex type with the
+ *                  same component type before its magnitude is computed.
+ * @tparam AccumTag Accumulator tag used for the multiplications.
+ */
+template <unsigned Taps, unsigned Lanes, ElemBaseType RefType, ElemBaseType DataType, typename MagType = int32,
+          AccumElemBaseType AccumTag = detail::default_accum_tag_t<RefType, DataType>>
+    requires(Taps > 0 && detail::is_complex_v<RefType> && detail::is_complex_v<DataType> &&
+             detail::utils::is_one_of_v<MagType, int32, int16> &&
+             is_valid_mul_op_v<RefType, DataType> && Lanes * detail::type_bits_v<DataType> >= 128)
+class correlator
+{
+    using chunks_type = detail::fir_chunks<Taps, Lanes, RefType, DataType, AccumTag>;
+    using corr_type   = detail::add_complex_t<MagType>;
+
+public:
+    /** Number of samples of the reference sequence */
+    static constexpr unsigned taps  = Taps;
+    /** Number of input samples consumed in each step */
+    static constexpr unsigned lanes = Lanes;
+
+    using hit_type = correlator_hit<MagType>;
+
+    /**
+     * Creates a correlator for the given reference sequence, with a history of zeros.
+     *
+     * @param ref Pointer to Taps reference samples. They are conjugated by the correlator. It does not need to be
+     *            aligned.
+     */
+    explicit correlator(const RefType *ref) :
+        coeffs_(chunks_type::make_coeffs(ref, detail::fir_index<Taps>())),
+        position_(0),
+        best_(aie::zeros<MagType, Lanes>()),
+        best_pos_(aie::zeros<int32, Lanes>())
+    {
+        for (auto &c : coeffs_)
+            c = aie::conj(c);
+    }
+
+    /**
+     * Clears the history of the correlator, as if all the previous samples were zero, and restarts the sample count
+     * and the peak search.
+     */
+    void reset()
+    {
+        delay_line_.reset();
+
+        position_ = 0;
+        best_     = aie::zeros<MagType, Lanes>();
+        best_pos_ = aie::zeros<int32, Lanes>();
+    }
+
+    /**
+     * Consumes a block of input samples and returns the squared magnitudes of the correlation at each of them. The
+     * magnitudes are also used to update the peak.
+     *
+     * @param samples   Block of Lanes input samples.
+     * @param shift     Shift applied to the accumulated correlation when it is converted to the complex type of MagType.
+     * @param mag_shift Shift applied to the squared magnitudes.
+     */
+    __aie_inline
+    vector<MagType, Lanes> magnitude(const vector<DataType, Lanes> &samples, int shift = 0, int mag_shift = 0)
+    {
+        const auto corr = chunks_type::run(coeffs_, delay_line_.push(samples)).template to_vector<corr_type>(shift);
+        const auto mag  = aie::abs_square<MagType>(corr, mag_shift);
+
+        mask<Lanes> larger;
+        std::tie(best_, larger) = aie::max_cmp(best_, mag);
+        best_pos_ = aie::select(best_pos_, int32(position_), larger);
+
+        position_ += Lanes;
+
+        return mag;
+    }
+
+    /**
+     * Correlates a block of samples and writes the samples whose magnitude reaches the threshold, in order. The peak
+     * is updated with all the samples, including the ones that are not written.
+     *
+     * @param in        Input samples.
+     * @param n         Number of samples. It must be a multiple of Lanes.
+     * @param threshold Minimum squared magnitude of a hit.
+     * @param hits      Output hits.
+     * @param max_hits  Maximum number of hits written to the output.
+     * @param shift     Shift applied to the accumulated correlation when it is converted to the complex type of MagType.
+     * @param mag_shift Shift applied to the squared magnitudes.
+     *
+     * @return Number of hits written to the output.
+     */
+    unsigned run(const DataType * __restrict in, unsigned n, MagType threshold,
+                 hit_type * __restrict hits, unsigned max_hits, int shift = 0, int mag_shift = 0)
+    {
+        unsigned num_hits = 0;
+
+        for (unsigned i = 0; i < n / Lanes; ++i)
+            chess_prepare_for_pipelining
+        {
+            const unsigned first = position_;
+            const auto     mag   = magnitude(load_v<Lanes>(in + i * Lanes), shift, mag_shift);
+            const auto     found = aie::ge(mag, threshold);
+
+            if (!found.empty()) {
+                for (unsigned l = 0; l < Lanes; ++l) {
+                    if (found.test(l) && num_hits < max_hits)
+                        hits[num_hits++] = {first + l, mag.get(l)};
+                }
+            }
+        }
+
+        return num_hits;
+    }
+
+    /**
+     * Returns the sample with the largest magnitude since the last reset. If several samples have the same magnitude,
+     * the first one is returned.
+     */
+    hit_type peak() const
+    {
+        const MagType max = aie::reduce_max(best_);
+
+        hit_type ret{~0u, max};
+
+        for (unsigned l = 0; l < Lanes; ++l) {
+            if (best_.get(l) == max)
+                ret.index = std::min(ret.index, unsigned(best_pos_.get(l)) + l);
+        }
+
+        return ret;
+    }
+
+private:
+    typename chunks_type::coeff_storage           coeffs_;
+    detail::fir_delay_line<Taps, Lanes, DataType> delay_line_;
+    unsigned                                      position_;
+    vector<MagType, Lanes>                        best_;
+    vector<int32, Lanes>                          best_pos_;
+};
+
+} // namespace aie
+
+#endif
@@ -0,0 +1,402 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2022 Xilinx, Inc.
+// Copyright (C) 2022-2026 Advanced Micro Devices, Inc.
+
+/**
+ * @file
+ * @brief Matrix multiplication of tiled matrices built on top of mmul.
+ */
+
+#pragma once
+
+#ifndef __AIE_API_GEMM__HPP__
+#define __AIE_API_GEMM__HPP__
+
+namespace aie {
+
+/**
+ * @ingroup group_mmul
+ *
+ * Register blocking used by gemm for a given mmul shape.
+ *
+ * The output matrix is computed in blocks of grid_rows x grid_cols tiles of MxN elements, whose accumulators are kept
+ * in registers while the whole inner dimension is traversed. The grid is the largest one (up to 4x4 tiles) whose
+ * accumulators fit in the accumulator registers of the target architecture. This amortizes the loads of A and B tiles
+ * over several multiplications.
+ *
+ * @tparam M        Rows of the A and C tiles.
+ * @tparam K        Columns of the A tiles and rows of the B tiles.
+ * @tparam N        Columns of the B and C tiles.
+ * @tparam TypeA    Type of the elements of matrix A.
+ * @tparam TypeB    Type of the elements of matrix B.
+ * @tparam AccumTag Accumulator tag used for the multiplications.
+ */
+template <unsigned M, unsigned K, unsigned N, typename TypeA, typename TypeB, AccumElemBaseType AccumTag = accauto>
+struct gemm_config
+{
+    /** mmul type used to multiply each pair of tiles */
+    using mmul_type = mmul<M, K, N, TypeA, TypeB, AccumTag>;
+
+    /** Number of tile rows of C computed at the same time */
+    static constexpr unsigned grid_rows = detail::gemm_accum_grid(M * N * mmul_type::accum_bits)[0];
+    /** Number of tile columns of C computed at the same time */
+    static constexpr unsigned grid_cols = detail::gemm_accum_grid(M * N * mmul_type::accum_bits)[1];
+
+    /** The number of rows of A and C must be a multiple of this value */
+    static constexpr unsigned rows_multiple  = M * grid_rows;
+    /** The number of columns of A and rows of B must be a multiple of this value */
+    static constexpr unsigned inner_multiple = K;
+    /** The number of columns of B and C must be a multiple of this value */
+    static constexpr unsigned cols_multiple  = N * grid_cols;
+};
+
+/**
+ * @ingroup group_mmul
+ *
+ * gemm_config with the default mmul shape for the given input types on the target architecture.
+ *
+ * Defaults are provided for 8b and 16b integer types, and floating point types that have native support. Other type
+ * combinations must use gemm_config with an explicit shape.
+ */
+template <typename TypeA, typename TypeB, AccumElemBaseType AccumTag = accauto>
+    requires(detail::gemm_default_shape<TypeA, TypeB>()[0] != 0)
+using default_gemm_config = gemm_config<detail::gemm_default_shape<TypeA, TypeB>()[0],
+                                        detail::gemm_default_shape<TypeA, TypeB>()[1],
+                                        detail::gemm_default_shape<TypeA, TypeB>()[2],
+                                        TypeA, TypeB, AccumTag>;
+
+/**
+ * @ingroup group_mmul
+ *
+ * Default gemm epilogue, which converts the accumulators of each output tile to TypeC.
+ *
+ * gemm epilogues are callables that receive the mmul object with the result of an output tile and the coordinates of
+ * the first element of the tile in the output matrix, and return the vector that is stored to the tile:
+ *
+ * @code
+ * template <typename MMul>
+ * vector<TypeC, MMul::size_C> operator()(const MMul &c, unsigned row, unsigned col) const;
+ * @endcode
+ *
+ * @tparam TypeC Type of the elements of matrix C.
+ */
+template <typename TypeC>
+struct gemm_shift_epilogue
+{
+    int shift = 0;
+
+    template <typename MMul>
+    __aie_inline
+    vector<TypeC, MMul::size_C> operator()(const MMul &c, unsigned row, unsigned col) const
+    {
+        return c.template to_vector<TypeC>(shift);
+    }
+};
+
+/**
+ * @ingroup group_mmul
+ *
+ * Activation that leaves the values unchanged.
+ */
+struct gemm_identity_activation
+{
+    template <typename T, unsigned Elems>
+    __aie_inline
+    vector<T, Elems> operator()(const vector<T, Elems> &v) const
+    {
+        return v;
+    }
+};
+
+/**
+ * @ingroup group_mmul
+ *
+ * Rectified linear unit activation: max(x, 0).
+ */
+struct gemm_relu_activation
+{
+    template <typename T, unsigned Elems>
+    __aie_inline
+    vector<T, Elems> operator()(const vector<T, Elems> &v) const
+    {
+        return max(v, zeros<T, Elems>());
+    }
+};
+
+/**
+ * @ingroup group_mmul
+ *
+ * Dimension of the output matrix indexed by the per-channel parameters of gemm_requantize_epilogue.
+ */
+enum class gemm_channels
+{
+    per_row, ///< One value per row of the output matrix
+    per_col, ///< One value per column of the output matrix
+};
+
+/**
+ * @ingroup group_mmul
+ *
+ * gemm epilogue that adds a per-channel bias, applies a per-channel scale and an activation function to each output
+ * tile before it is stored, so none of these steps requires an additional pass over the output matrix.
+ *
+ * For integer types the computation of each element is:
+ *
+ * @code
+ * acc = A x B + bias[ch]; // In the accumulator, before any rounding
+ * out = activation(srs(int32(acc) * scale[ch], shift));
+ * @endcode
+ *
+ * and for floating point types:
+ *
+ * @code
+ * out = activation(TypeC((A x B + bias[ch]) * scale[ch]));
+ * @endcode
+ *
+ * When Bias or Scale are void, the corresponding step is removed. When Scale is void, the accumulators are directly
+ * converted to TypeC with the given shift.
+ *
+ * The activation is any callable that takes and returns a vector of TypeC, such as gemm_relu_activation or a function
+ * built on parallel_lookup or linear_approx.
+ *
+ * @tparam TypeC      Type of the elements of matrix C.
+ * @tparam Bias       Type of the bias values. For integer types, it is the type added to the accumulator (usually
+ *                    int32). It can be void.
+ * @tparam Scale      Type of the per-channel scale factors (usually int16 for integer types). It can be void.
+ * @tparam Channels   Whether parameters are given per row or per column of the output matrix.
+ * @tparam Activation Type of the activation function.
+ */
+template <typename TypeC, typename Bias, typename Scale, gemm_channels Channels = gemm_channels::per_col,
+          typename Activation = gemm_identity_activation>
+class gemm_requantize_epilogue
+{
+public:
+    /**
+     * @param bias       Pointer to one bias value per channel. Ignored if Bias is void.
+     * @param scale      Pointer to one scale factor per channel. Ignored if Scale is void.
+     * @param shift      Downshift applied to the scaled values. Ignored for floating point types.
+     * @param activation Activation function.
+     */
+    __aie_inline
+    gemm_requantize_epilogue(const Bias *bias, const Scale *scale, int shift = 0, const Activation &activation = {}) :
+        bias_(bias), scale_(scale), shift_(shift), activation_(activation)
+    {}
+
+    template <typename MMul>
+    __aie_inline
+    vector<TypeC, MMul::size_C> operator()(const MMul &c, unsigned row, unsigned col) const
+    {
+        const unsigned ch = Channels == gemm_channels::per_row? row : col;
+
+        auto acc = c.to_accum();
+
+        if constexpr (!std::is_void_v<Bias>)
+            acc = add(acc, load_channels<MMul::M, MMul::N>(bias_ + ch));
+
+        if constexpr (std::is_void_v<Scale>) {
+            return activation_(acc.template to_vector<TypeC>(shift_));
+        }
+        else if constexpr (detail::is_floating_point_v<TypeC>) {
+            const auto scaled = mul(acc.template to_vector<float>(), load_channels<MMul::M, MMul::N>(scale_ + ch));
+
+            return activation_(scaled.template to_vector<TypeC>());
+        }
+        else {
+            const auto scaled = mul(acc.template to_vector<int32>(), load_channels<MMul::M, MMul::N>(scale_ + ch));
+
+            return activation_(scaled.template to_vector<TypeC>(shift_));
+        }
+    }
+
+private:
+    // Expands the parameters of the channels of a tile to the row-major layout of the tile
+    template <unsigned M, unsigned N, typename T>
+    __aie_inline
+    static vector<T, M * N> load_channels(const T *p)
+    {
+        vector<T, M * N> ret;
+
+        if constexpr (N * detail::type_bits_v<T> < 128) {
+            detail::utils::unroll_times<M>([&](unsigned m) __aie_inline {
+                detail::utils::unroll_times<N>([&](unsigned n) __aie_inline {
+                    ret.set(Channels == gemm_channels::per_row? p[m] : p[n], m * N + n);
+                });
+            });
+        }
+        else if constexpr (Channels == gemm_channels::per_row) {
+            detail::utils::unroll_times<M>([&](unsigned m) __aie_inline {
+                ret.insert(m, broadcast<T, N>(p[m]));
+            });
+        }
+        else {
+            const vector<T, N> v = load_unaligned_v<N>(p);
+
+            detail::utils::unroll_times<M>([&](unsigned m) __aie_inline {
+                ret.insert(m, v);
+            });
+        }
+
+        return ret;
+    }
+
+    const Bias  *bias_;
+    const Scale *scale_;
+    int          shift_;
+    Activation   activation_;
+};
+
+/**
+ * @ingroup group_mmul
+ *
+ * Computes C = A x B on matrices stored in the tiled layout of the given mmul shape (see @ref mmul_tiling).
+ *
+ * A is arranged as a row-major grid of (rows / M) x (inner / K) tiles, B as a row-major grid of (inner / K) x (cols / N)
+ * tiles and C as a row-major grid of (rows / M) x (cols / N) tiles. The elements in each tile are in row-major order.
+ *
+ * Output tiles are computed in blocks whose size is given by gemm_config. The result of each tile is passed to the
+ * epilogue while it is still in the accumulator registers, and the returned vector is stored to C.
+ *
+ * @param A        Pointer to matrix A. It must be aligned to the size of a tile.
+ * @param B        Pointer to matrix B. It must be aligned to the size of a tile.
+ * @param C        Pointer to matrix C. It must be aligned to the size of a tile.
+ * @param rows     Number of rows of A and C. It must be a multiple of gemm_config::rows_multiple.
+ * @param inner    Number of columns of A and rows of B. It must be a multiple of gemm_config::inner_multiple.
+ * @param cols     Number of columns of B and C. It must be a multiple of gemm_config::cols_multiple.
+ * @param epilogue Function that converts the result of each output tile to TypeC (see gemm_shift_epilogue).
+ *
+ * @tparam M        Rows of the A and C tiles.
+ * @tparam K        Columns of the A tiles and rows of the B tiles.
+ * @tparam N        Columns of the B and C tiles.
+ * @tparam TypeA    Type of the elements of matrix A.
+ * @tparam TypeB    Type of the elements of matrix B.
+ * @tparam TypeC    Type of the elements of matrix C.
+ * @tparam AccumTag Accumulator tag used for the multiplications.
+ */
+template <unsigned M, unsigned K, unsigned N, typename TypeA, typename TypeB, typename TypeC,
+          AccumElemBaseType AccumTag = accauto, typename Epilogue>
+    requires(std::is_class_v<std::remove_cvref_t<Epilogue>>)
+__aie_inline
+void gemm(const TypeA * __restrict A, const TypeB * __restrict B, TypeC * __restrict C,
+          unsigned rows, unsigned inner, unsigned cols, Epilogue &&epilogue)
+{
+    using config = gemm_config<M, K, N, TypeA, TypeB, AccumTag>;
+    using MMUL   = typename config::mmul_type;
+
+    constexpr unsigned Rows = config::grid_rows;
+    constexpr unsigned Cols = config::grid_cols;
+
+    REQUIRES_MSG(rows  % config::rows_multiple  == 0, "The number of rows must be a multiple of the accumulator grid");
+    REQUIRES_MSG(inner % config::inner_multiple == 0, "The inner dimension must be a multiple of the tile size");
+    REQUIRES_MSG(cols  % config::cols_multiple  == 0, "The number of columns must be a multiple of the accumulator grid");
+
+    const unsigned tiles_k = inner / K;
+    const unsigned tiles_n = cols  / N;
+
+    for (unsigned i = 0; i < rows / M; i += Rows)
+        chess_loop_range(1,)
+    {
+        for (unsigned j = 0; j < tiles_n; j += Cols)
+            chess_loop_range(1,)
+        {
+            const TypeA * __restrict pA = A + i * tiles_k * MMUL::size_A;
+            const TypeB * __restrict pB = B + j * MMUL::size_B;
+
+            // Default constructed accumulators are treated as zero by the first mac
+            std::array<MMUL, Rows * Cols> acc;
+
+            for (unsigned k = 0; k < tiles_k; ++k)
+                chess_prepare_for_pipelining
+                chess_loop_range(1,)
+            {
+                std::array<vector<TypeA, MMUL::size_A>, Rows> a;
+                std::array<vector<TypeB, MMUL::size_B>, Cols> b;
+
+                detail::utils::unroll_times<Rows>([&](unsigned r) __aie_inline {
+                    a[r] = load_v<MMUL::size_A>(pA + r * tiles_k * MMUL::size_A);
+                });
+                detail::utils::unroll_times<Cols>([&](unsigned c) __aie_inline {
+                    b[c] = load_v<MMUL::size_B>(pB + c * MMUL::size_B);
+                });
+
+                detail::utils::unroll_times<Rows>([&](unsigned r) __aie_inline {
+                    detail::utils::unroll_times<Cols>([&](unsigned c) __aie_inline {
+                        acc[r * Cols + c].mac(a[r], b[c]);
+                    });
+                });
+
+                pA += MMUL::size_A;
+                pB += tiles_n * MMUL::size_B;
+            }
+
+            detail::utils::unroll_times<Rows>([&](unsigned r) __aie_inline {
+                TypeC * __restrict pC = C + ((i + r) * tiles_n + j) * MMUL::size_C;
+
+                detail::utils::unroll_times<Cols>([&](unsigned c) __aie_inline {
+                    store_v(pC + c * MMUL::size_C, epilogue(acc[r * Cols + c], (i + r) * M, (j + c) * N));
+                });
+            });
+        }
+    }
+}
+
+/**
+ * @ingroup group_mmul
+ *
+ * Computes C = A x B on tiled matrices, converting the results to TypeC with the given shift.
+ *
+ * See the gemm overload with an epilogue for a description of the layout and the other parameters.
+ *
+ * @param shift Downshift applied to the results. Ignored for floating point types.
+ */
+template <unsigned M, unsigned K, unsigned N, typename TypeA, typename TypeB, typename TypeC,
+          AccumElemBaseType AccumTag = accauto>
+__aie_inline
+void gemm(const TypeA * __restrict A, const TypeB * __restrict B, TypeC * __restrict C,
+          unsigned rows, unsigned inner, unsigned cols, int shift = 0)
+{
+    gemm<M, K, N, TypeA, TypeB, TypeC, AccumTag>(A, B, C, rows, inner, cols, gemm_shift_epilogue<TypeC>{shift});
+}
+
+/**
+ * @ingroup group_mmul
+ *
+ * Computes C = A x B on tiled matrices, using the default mmul shape for the input types on the target architecture.
+ *
+ * The tile shape and the dimension requirements are given by default_gemm_config. See the gemm overload with an
+ * explicit shape for a description of the layout and parameters.
+ *
+ * @tparam TypeA    Type of the elements of matrix A.
+ * @tparam TypeB    Type of the elements of matrix B.
+ * @tparam TypeC    Type of the elements of matrix C.
+ * @tparam AccumTag Accumulator tag used for the multiplications.
+ */
+template <typename TypeA, typename TypeB, typename TypeC, AccumElemBaseType AccumTag = accauto, typename Epilogue>
+    requires(detail::gemm_default_shape<TypeA, TypeB>()[0] != 0 && std::is_class_v<std::remove_cvref_t<Epilogue>>)
+__aie_inline
+void gemm(const TypeA * __restrict A, const TypeB * __restrict B, TypeC * __restrict C,
+          unsigned rows, unsigned inner, unsigned cols, Epilogue &&epilogue)
+{
+    constexpr auto shape = detail::gemm_default_shape<TypeA, TypeB>();
+
+    gemm<shape[0], shape[1], shape[2], TypeA, TypeB, TypeC, AccumTag>(A, B, C, rows, inner, cols,
+                                                                     std::forward<Epilogue>(epilogue));
+}
+
+/**
+ * @ingroup group_mmul
+ *
+ * Computes C = A x B on tiled matrices, using the default mmul shape for the input types on the target architecture,
+ * and converting the results to TypeC with the given shift.
+ */
+template <typename TypeA, typename TypeB, typename TypeC, AccumElemBaseType AccumTag = accauto>
+    requires(detail::gemm_default_shape<TypeA, TypeB>()[0] != 0)
+__aie_inline
+void gemm(const TypeA * __restrict A, const TypeB * __restrict B, TypeC * __restrict C,
+          unsigned rows, unsigned inner, unsigned cols, int shift = 0)
+{
+    gemm<TypeA, TypeB, TypeC, AccumTag>(A, B, C, rows, inner, cols, gemm_shift_epilogue<TypeC>{shift});
+}
+
+} // namespace aie
+
+#endif
@@ -0,0 +1,297 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2022 Xilinx, Inc.
+// Copyright (C) 2022-2026 Advanced Micro Devices, Inc.
+
+/**
+ * @file
+ * @brief Recursive filters computed in blocks with sliding_mul_ops.
+ */
+
+#pragma once
+
+#ifndef __AIE_API_IIR__HPP__
+#define __AIE_API_IIR__HPP__
+
+#include "detail/constexpr_math.hpp"
+
+#include "fir.hpp"
+
+namespace aie {
+
+/**
+ * @ingroup group_mul_special
+ *
+ * Coefficients of a second-order section, normalized so that a0 = 1:
+ *
+ * @code
+ * y[n] = b0 * x[n] + b1 * x[n - 1] + b2 * x[n - 2] - a1 * y[n - 1] - a2 * y[n - 2]
+ * @endcode
+ */
+struct biquad_coeffs
+{
+    float b0, b1, b2;
+    float a1, a2;
+};
+
+namespace detail {
+
+// Response of a second-order section over a block of Lanes samples to a unit impulse at the start of the block
+// (Impulse), or to a unit value in one of the samples that precede the block, with all the other samples set to zero.
+enum class biquad_response { Impulse, X1, X2, Y1, Y2 };
+
+template <unsigned Lanes>
+static std::array<double, Lanes> biquad_block_response(const biquad_coeffs &c, biquad_response r)
+{
+    std::array<double, Lanes> ret;
+
+    double x1 = r == biquad_response::X1, x2 = r == biquad_response::X2;
+    double y1 = r == biquad_response::Y1, y2 = r == biquad_response::Y2;
+
+    for (unsigned n = 0; n < Lanes; ++n) {
+        const double x = (n == 0 && r == biquad_response::Impulse)? 1.0 : 0.0;
+        const double y = c.b0 * x + c.b1 * x1 + c.b2 * x2 - c.a1 * y1 - c.a2 * y2;
+
+        x2 = x1; x1 = x;
+        y2 = y1; y1 = y;
+
+        ret[n] = y;
+    }
+
+    return ret;
+}
+
+// One section of a biquad_cascade. The outputs of a block are linear in the samples of the block and in the last two
+// inputs and outputs of the previous block:
+//
+//   y[n] = sum(h[k] * x[n - k], k = 0..n) + ex1[n] * x[-1] + ex2[n] * x[-2] + ey1[n] * y[-1] + ey2[n] * y[-2]
+//
+// The first term is a Lanes-tap FIR filter over a window whose history is zero, and the rest is the response to the
+// previous block, which is computed at the end of each block and kept in an accumulator.
+//
+// The impulse response h is quantized with CoeffShift fractional bits, like the outputs. The responses to the previous
+// block grow quickly as the poles approach the unit circle, so they are quantized with the largest number of fractional
+// bits that fits their range, which is chosen for each section.
+template <unsigned Lanes, typename DataType, typename AccumTag>
+struct biquad_section
+{
+    using accum_tag   = accum_tag_or_default_t<AccumTag, int16, DataType>;
+    using chunks_type = fir_chunks<Lanes, Lanes, int16, DataType, AccumTag>;
+    using accum_type  = typename chunks_type::accum_type;
+
+    static std::array<int16, Lanes> quantize(const std::array<double, Lanes> &v, unsigned shift)
+    {
+        std::array<int16, Lanes> ret;
+
+        for (unsigned i = 0; i < Lanes; ++i) {
+            REQUIRES_MSG(v[i] * (1 << shift) > -32768.5 && v[i] * (1 << shift) < 32767.5,
+                         "The block response of the section does not fit in int16 with the given CoeffShift");
+
+            ret[i] = constexpr_math::to_fixed<int16>(v[i], shift);
+        }
+
+        return ret;
+    }
+
+    template <unsigned CoeffShift>
+    void init(const biquad_coeffs &c)
+    {
+        // The FIR filter applies its first coefficient to the oldest sample
+        std::array<int16, Lanes> impulse = quantize(biquad_block_response<Lanes>(c, biquad_response::Impulse),
+                                                    CoeffShift);
+        std::reverse(impulse.begin(), impulse.end());
+
+        h = chunks_type::make_coeffs(impulse.data(), fir_index<Lanes>());
+
+        const std::array<std::array<double, Lanes>, 4> responses = {
+            biquad_block_response<Lanes>(c, biquad_response::X1),
+            biquad_block_response<Lanes>(c, biquad_response::X2),
+            biquad_block_response<Lanes>(c, biquad_response::Y1),
+            biquad_block_response<Lanes>(c, biquad_response::Y2)
+        };
+
+        double range = 0;
+        for (const auto &r : responses) {
+            for (double v : r)
+                range = std::max(range, v < 0? -v : v);
+        }
+
+        response_shift = 15;
+        while (response_shift > 0 && range * (1 << response_shift) >= 32767.5)
+            --response_shift;
+
+        for (unsigned r = 0; r < 4; ++r) {
+            const std::array<int16, Lanes> q = quantize(responses[r], response_shift);
+
+            for (unsigned i = 0; i < Lanes; ++i)
+                prev[r].set(q[i], i);
+        }
+
+        reset();
+    }
+
+    void reset()
+    {
+        state = aie::zeros<accum_tag, Lanes>();
+    }
+
+    // The window holds a block of zeros followed by the input samples
+    template <unsigned CoeffShift>
+    __aie_inline
+    accum_type run(const DataType *window, const vector<DataType, Lanes> &samples)
+    {
+        const accum_type acc = chunks_type::run(h, window, state);
+
+        // The outputs are fed back with the precision of the accumulator. The inputs are scaled to the same precision,
+        // so that the four responses are accumulated together.
+        const vector<int32, Lanes> y = acc.template to_vector<int32>(0);
+
+        auto next = aie::mul(prev[0], int32(samples.get(Lanes - 1)) << CoeffShift);
+        next      = aie::mac(next, prev[1], int32(samples.get(Lanes - 2)) << CoeffShift);
+        next      = aie::mac(next, prev[2], y.get(Lanes - 1));
+        next      = aie::mac(next, prev[3], y.get(Lanes - 2));
+
+        state = accum_type(next.template to_vector<int32>(response_shift));
+
+        return acc;
+    }
+
+    typename chunks_type::coeff_storage   h;
+    // Responses to x[-1], x[-2], y[-1] and y[-2], with response_shift fractional bits
+    std::array<vector<int16, Lanes>, 4>   prev;
+    unsigned                              response_shift;
+    accum_type                            state;
+};
+
+} // namespace detail
+
+/**
+ * @ingroup group_mul_special
+ *
+ * Cascade of second-order IIR sections (biquads) computed in blocks of Lanes samples.
+ *
+ * A recursive filter cannot be vectorized sample by sample, as each output depends on the previous ones. Instead, the
+ * outputs of each block are expressed as a linear function of the samples of the block and of the last two inputs and
+ * outputs of the previous block. The coefficients of that function are the responses of the section over a block,
+ * which are computed and quantized when the object is created. The contribution of the samples of the block is
+ * computed as a FIR filter with sliding_mul_ops, and the contribution of the previous block with four element-wise
+ * multiplications, whose result is kept in an accumulator until the next call. The outputs are fed back with the
+ * precision of the accumulator.
+ *
+ * The impulse response of each section over a block is quantized to int16 with CoeffShift fractional bits, so it must
+ * be within the range of that format, and the outputs of each section have CoeffShift fractional bits. They are
+ * scaled by 2^-CoeffShift before they are passed to the next section. The responses to the previous block are
+ * quantized with as many fractional bits as their range allows.
+ *
+ * @code
+ * // DC blocker: y[n] = x[n] - x[n - 1] + 0.995 * y[n - 1]
+ * aie::biquad_cascade<1, 16> dc({aie::biquad_coeffs{1.0f, -1.0f, 0.0f, -0.995f, 0.0f}});
+ *
+ * dc.run(in, out, frame_size);
+ * @endcode
+ *
+ * @tparam Stages     Number of second-order sections.
+ * @tparam Lanes      Number of samples computed in each call to filter.
+ * @tparam DataType   Type of the data samples.
+ * @tparam CoeffShift Number of fractional bits of the quantized block responses.
+ * @tparam AccumTag   Accumulator tag used for the multiplications.
+ */
+template <unsigned Stages, unsigned Lanes, ElemBaseType DataType = int16, unsigned CoeffShift = 14,
+          AccumElemBaseType AccumTag = acc48>
+    requires(Stages > 0 && std::is_same_v<DataType, int16> && Lanes >= 8 && CoeffShift < 16)
+class biquad_cascade
+{
+    using section_type = detail::biquad_section<Lanes, DataType, AccumTag>;
+
+public:
+    /** Number of second-order sections */
+    static constexpr unsigned stages = Stages;
+    /** Number of samples computed in each call to filter */
+    static constexpr unsigned lanes  = Lanes;
+
+    using accum_type = typename section_type::accum_type;
+
+    /**
+     * Creates a filter with the given sections and a history of zeros.
+     *
+     * @param coeffs Pointer to the coefficients of the Stages sections, in the order in which they are applied.
+     */
+    explicit biquad_cascade(const biquad_coeffs *coeffs)
+    {
+        for (unsigned s = 0; s < Stages; ++s)
+            sections_[s].template init<CoeffShift>(coeffs[s]);
+
+        for (unsigned i = 0; i < Lanes; ++i)
+            window_[i] = DataType(0);
+    }
+
+    /**
+     * Creates a filter with the given sections and a history of zeros.
+     *
+     * @param coeffs Coefficients of the sections, in the order in which they are applied.
+     */
+    explicit biquad_cascade(const std::array<biquad_coeffs, Stages> &coeffs) :
+        biquad_cascade(coeffs.data())
+    {
+    }
+
+    /**
+     * Clears the history of the filter, as if all the previous samples were zero.
+     */
+    void reset()
+    {
+        for (auto &section : sections_)
+            section.reset();
+    }
+
+    /**
+     * Consumes a block of input samples and returns the accumulated outputs of the last section that correspond to
+     * them. The outputs have CoeffShift fractional bits.
+     *
+     * @param samples Block of Lanes input samples.
+     */
+    __aie_inline
+    accum_type filter(const vector<DataType, Lanes> &samples)
+    {
+        vector<DataType, Lanes> x = samples;
+        accum_type acc;
+
+        detail::utils::unroll_times<Stages>([&](unsigned s) __aie_inline {
+            store_v(window_ + Lanes, x);
+
+            acc = sections_[s].template run<CoeffShift>(window_, x);
+
+            if (s + 1 < Stages)
+                x = acc.template to_vector<DataType>(CoeffShift);
+        });
+
+        return acc;
+    }
+
+    /**
+     * Filters a block of samples and writes the outputs, converted to OutType.
+     *
+     * @param in    Input samples.
+     * @param out   Output samples.
+     * @param n     Number of samples. It must be a multiple of Lanes.
+     * @param shift Shift applied to the accumulated outputs when they are converted to OutType.
+     */
+    template <ElemBaseType OutType>
+    void run(const DataType * __restrict in, OutType * __restrict out, unsigned n, int shift = CoeffShift)
+    {
+        for (unsigned i = 0; i < n / Lanes; ++i)
+            chess_prepare_for_pipelining
+        {
+            const accum_type acc = filter(load_v<Lanes>(in + i * Lanes));
+
+            store_v(out + i * Lanes, acc.template to_vector<OutType>(shift));
+        }
+    }
+
+private:
+    std::array<section_type, Stages>            sections_;
+    alignas(detail::vector_decl_align) DataType window_[2 * Lanes];
+};
+
+} // namespace aie
+
+#endif
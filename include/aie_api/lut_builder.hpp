@@ -0,0 +1,269 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2022 Xilinx, Inc.
+// Copyright (C) 2022-2026 Advanced Micro Devices, Inc.
+
+/**
+ * @file
+ * @brief Lookup tables sampled from a function and laid out for parallel accesses at compile time.
+ */
+
+#pragma once
+
+#ifndef __AIE_API_LUT_BUILDER__HPP__
+#define __AIE_API_LUT_BUILDER__HPP__
+
+#include <array>
+
+#include "detail/constexpr_math.hpp"
+#include "detail/lut.hpp"
+
+namespace aie {
+
+/**
+ * @ingroup group_lut
+ *
+ * Interval of the inputs covered by a table built with @ref make_lut, in the units of the sampled function.
+ */
+struct lut_domain
+{
+    double min; /**< Input of the first entry */
+    double max; /**< End of the input interval of the last entry */
+};
+
+namespace detail {
+
+// Offset of the line with the given slope that approximates a function over [0, w], given the values of the function at
+// 0, w / 2 and w. It balances the errors at the ends and at the middle of the interval, which is close to the minimax
+// line when the curvature of the function does not change sign within the interval.
+constexpr double lut_line_offset(double f0, double fm, double fw, double slope, double w)
+{
+    return (f0 + fw) / 4 + fm / 2 - slope * w / 2;
+}
+
+// Type in which the values of a table are stored. 8b values are stored as 16b values, bfloat16 values are stored as
+// their bit patterns, and the bfloat16 slopes of floating-point linear approximations are stored as floats.
+template <typename OffsetType, typename SlopeType>
+struct lut_storage
+{
+    using type = std::conditional_t<type_bits_v<OffsetType> == 8,
+                                    std::conditional_t<std::is_signed_v<OffsetType>, int16, uint16>,
+                                    std::conditional_t<std::is_same_v<OffsetType, bfloat16>, uint16, OffsetType>>;
+};
+
+template <typename OffsetType, typename SlopeType>
+using lut_storage_t = typename lut_storage<OffsetType, SlopeType>::type;
+
+// Rounds a value to the given type and returns it as stored in a table
+template <typename T, typename Storage>
+constexpr Storage lut_quantize(double x)
+{
+    if constexpr (std::is_integral_v<T>)
+        return Storage(constexpr_math::to_fixed<T>(x));
+    else if constexpr (std::is_same_v<T, bfloat16> && std::is_same_v<Storage, uint16>)
+        return constexpr_math::to_bfloat16_bits(x);
+    else if constexpr (std::is_same_v<T, bfloat16>)
+        return Storage(constexpr_math::from_bfloat16_bits(constexpr_math::to_bfloat16_bits(x)));
+    else
+        return Storage(x);
+}
+
+template <typename T, typename Storage>
+constexpr double lut_dequantize(Storage x)
+{
+    if constexpr (std::is_same_v<T, bfloat16> && std::is_same_v<Storage, uint16>)
+        return constexpr_math::from_bfloat16_bits(x);
+    else
+        return double(x);
+}
+
+} // namespace detail
+
+/**
+ * @ingroup group_lut
+ *
+ * Contents of a lookup table built by @ref make_lut, laid out in memory as required by @ref aie::lut for the given
+ * number of parallel accesses. A table for 4 parallel accesses holds one of the two copies that @ref aie::lut needs,
+ * so the table must be declared twice, and the two objects must be placed in different memory banks.
+ *
+ * Tables without a SlopeType hold values for @ref aie::parallel_lookup. Tables with a SlopeType hold slope/offset
+ * pairs for @ref aie::linear_approx, with the slope at the lower address.
+ *
+ * @tparam ParallelAccesses Number of parallel accesses of the @ref aie::lut that uses the table.
+ * @tparam Elems            Number of entries in the table.
+ * @tparam OffsetType       Type of the values, or of the offsets of a linear approximation.
+ * @tparam SlopeType        Type of the slopes of a linear approximation, or void for direct lookups.
+ */
+template <unsigned ParallelAccesses, unsigned Elems, typename OffsetType, typename SlopeType = void>
+    requires((ParallelAccesses == 1 || ParallelAccesses == 2 || ParallelAccesses == 4) &&
+             (std::is_void_v<SlopeType> || std::is_same_v<OffsetType, SlopeType> ||
+              (std::is_same_v<OffsetType, float> && std::is_same_v<SlopeType, bfloat16>)))
+class alignas(detail::vector_decl_align) lut_table
+{
+public:
+    static constexpr bool is_linear = !std::is_void_v<SlopeType>;
+
+    using offset_type  = OffsetType;
+    using slope_type   = std::conditional_t<is_linear, SlopeType, OffsetType>;
+    using storage_type = detail::lut_storage_t<OffsetType, slope_type>;
+
+    /** Type of the @ref aie::lut that uses the table */
+    using lut_type = lut<ParallelAccesses, offset_type, slope_type>;
+
+    /** Number of entries in the table */
+    static constexpr unsigned elems = Elems;
+
+    /** Creates a table with all its entries set to zero. See @ref make_lut. */
+    explicit constexpr lut_table(int bias) : bias_(bias)
+    {
+    }
+
+    /** Returns a pointer to the contents of the table, to be passed to the constructor of @ref aie::lut. */
+    constexpr const storage_type *data() const
+    {
+        return values_.data();
+    }
+
+    /** Returns the bias to be passed to @ref aie::parallel_lookup or @ref aie::linear_approx. */
+    constexpr int bias() const
+    {
+        return bias_;
+    }
+
+    /** Sets all the copies of the given entry of a direct lookup table. */
+    constexpr void set(unsigned i, double value) requires(!is_linear)
+    {
+        for (unsigned copy = 0; copy < copies; ++copy)
+            values_[position(i, copy)] = detail::lut_quantize<offset_type, storage_type>(value);
+    }
+
+    /** Sets all the copies of the given entry of a linear approximation table. */
+    constexpr void set(unsigned i, double slope, double offset) requires(is_linear)
+    {
+        for (unsigned copy = 0; copy < copies; ++copy) {
+            values_[2 * position(i, copy)]     = detail::lut_quantize<slope_type,  storage_type>(slope);
+            values_[2 * position(i, copy) + 1] = detail::lut_quantize<offset_type, storage_type>(offset);
+        }
+    }
+
+    /** Returns the value of the given entry of a direct lookup table. */
+    constexpr double get(unsigned i) const requires(!is_linear)
+    {
+        return detail::lut_dequantize<offset_type>(values_[position(i, 0)]);
+    }
+
+    /** Returns the slope and the offset of the given entry of a linear approximation table. */
+    constexpr std::pair<double, double> get(unsigned i) const requires(is_linear)
+    {
+        return {detail::lut_dequantize<slope_type>(values_[2 * position(i, 0)]),
+                detail::lut_dequantize<offset_type>(values_[2 * position(i, 0) + 1])};
+    }
+
+private:
+    static constexpr unsigned entry_values = is_linear? 2 : 1;
+    static constexpr unsigned entry_bytes  = entry_values * sizeof(storage_type);
+    static constexpr unsigned copies       = ParallelAccesses == 1? 1 : 2;
+
+    static_assert(ParallelAccesses == 1 || (Elems * entry_bytes) % detail::lut_bank_bytes == 0,
+                  "Tables for parallel accesses must fill whole bank-width lines");
+
+    static constexpr unsigned position(unsigned i, unsigned copy)
+    {
+        if constexpr (ParallelAccesses == 1)
+            return i;
+        else
+            return detail::lut_interleaved_offset<entry_bytes>(i, copy);
+    }
+
+    std::array<storage_type, copies * entry_values * Elems> values_{};
+    int bias_;
+};
+
+/**
+ * @ingroup group_lut
+ *
+ * Builds, at compile time, a lookup table that samples a function over the given domain.
+ *
+ * The domain is split in Elems entries of width w = (max - min) / Elems, and each entry covers 2^step_bits inputs.
+ * Inputs are in units of w / 2^step_bits: an integer input y represents the value y * w / 2^step_bits of the
+ * function's argument, and floating-point inputs must be divided by w / 2^step_bits before the lookup, which is exact
+ * when it is a power of two. min / w must be an integer, and its negation is returned by lut_table::bias.
+ *
+ * The values of the function are multiplied by scale and rounded to the types of the table, with saturation for
+ * integer types. scale sets the fixed-point format of the outputs, e.g. 2^frac for outputs with frac fractional bits.
+ *
+ * - Direct lookup tables (void SlopeType) hold the function at the middle of the inputs of each entry.
+ * - Linear approximation tables hold, for each entry, the slope of the chord of the function over the entry, rounded
+ *   to SlopeType, and the offset that balances the errors at the ends and at the middle of the entry. For integer
+ *   types, the slope is per input unit and the offset is the value at the start of the entry, as computed by
+ *   @ref aie::linear_approx with shift_offset = 0. For floating-point types, the offset is the value at input 0.
+ *
+ * The tables can be modified after they are built, e.g. to continue the function with its asymptotes past the ends
+ * of the domain, with lut_table::set.
+ *
+ * @code
+ * constexpr auto gelu = [](double x) {
+ *     return 0.5 * x * (1.0 + aie::detail::constexpr_math::erf(x * 0.7071067811865476));
+ * };
+ *
+ * // int16 inputs and outputs with 12 fractional bits. Each entry covers 256 inputs.
+ * static constexpr auto table_ab = aie::make_lut<4, 256, int32, int32>(gelu, {-8.0, 8.0}, 8, 1 << 12);
+ * static constexpr auto table_cd = table_ab;
+ *
+ * decltype(table_ab)::lut_type lut(table_ab.elems, table_ab.data(), table_cd.data());
+ * aie::linear_approx<int16, decltype(lut)> approx(lut, 8, table_ab.bias());
+ * @endcode
+ *
+ * @param fn        Function to sample, which must be callable at compile time with a double argument.
+ * @param domain    Interval of the function's argument covered by the table.
+ * @param step_bits Number of low input bits that select a position within an entry.
+ * @param scale     Factor applied to the values of the function before they are rounded.
+ *
+ * @tparam ParallelAccesses Number of parallel accesses of the @ref aie::lut that uses the table.
+ * @tparam Elems            Number of entries in the table.
+ * @tparam OffsetType       Type of the values, or of the offsets of a linear approximation.
+ * @tparam SlopeType        Type of the slopes of a linear approximation, or void for direct lookups.
+ */
+template <unsigned ParallelAccesses, unsigned Elems, typename OffsetType, typename SlopeType = void, typename Fn>
+constexpr lut_table<ParallelAccesses, Elems, OffsetType, SlopeType>
+make_lut(const Fn &fn, lut_domain domain, unsigned step_bits = 0, double scale = 1.0)
+{
+    using table_type = lut_table<ParallelAccesses, Elems, OffsetType, SlopeType>;
+
+    const double w    = (domain.max - domain.min) / double(Elems);
+    const double span = double(uint64_t(1) << step_bits);
+
+    table_type ret(-int(detail::constexpr_math::round(domain.min / w)));
+
+    // Function at the given position, in entries from the start of the domain
+    auto f = [&](double t) {
+        return fn(domain.min + t * w) * scale;
+    };
+
+    for (unsigned i = 0; i < Elems; ++i) {
+        if constexpr (!table_type::is_linear) {
+            ret.set(i, f(double(i) + (span - 1) / (2 * span)));
+        }
+        else {
+            const double f0 = f(double(i));
+            const double fm = f(double(i) + 0.5);
+            const double fw = f(double(i) + 1.0);
+
+            using storage_type = typename table_type::storage_type;
+
+            const double slope  = detail::lut_dequantize<SlopeType>(
+                                      detail::lut_quantize<SlopeType, storage_type>((fw - f0) / span));
+            const double offset = detail::lut_line_offset(f0, fm, fw, slope, span);
+
+            if constexpr (std::is_integral_v<OffsetType>)
+                ret.set(i, slope, offset);
+            else
+                ret.set(i, slope, offset - slope * (double(i) - double(ret.bias())) * span);
+        }
+    }
+
+    return ret;
+}
+
+} // namespace aie
+
+#endif
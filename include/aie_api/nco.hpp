@@ -0,0 +1,226 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2022 Xilinx, Inc.
+// Copyright (C) 2022-2026 Advanced Micro Devices, Inc.
+
+/**
+ * @file
+ * @brief Numerically controlled oscillators and mixers.
+ */
+
+#pragma once
+
+#ifndef __AIE_API_NCO__HPP__
+#define __AIE_API_NCO__HPP__
+
+#include "detail/constexpr_math.hpp"
+
+namespace aie {
+
+/**
+ * @ingroup group_mul_special
+ *
+ * Numerically controlled oscillator that generates a complex exponential and mixes it with a signal.
+ *
+ * Phases use the same format as the integer inputs of @ref sincos_complex: a 32b value in which 2^32 is a full turn,
+ * i.e. a signed Q1.31 value scaled by 1 / pi. Each call to rotations returns the Lanes rotations (in cint16 Q.15) of
+ * the next block of samples:
+ *
+ * @code
+ * out[n] = (cos(phase + n * delta), sin(phase + n * delta))
+ * @endcode
+ *
+ * and advances the phase by Lanes * delta, so consecutive calls generate a continuous signal. mix multiplies a block of
+ * samples by the rotations with a single call to @ref mul, and run mixes a whole frame, which shifts the frequency of
+ * the signal by delta:
+ *
+ * @code
+ * // Shifts the signal down by fs / 8
+ * aie::nco<8> osc(-(1u << 29));
+ *
+ * osc.run(in, out, frame_size);
+ * @endcode
+ *
+ * On AIE, the object keeps the phase of each lane in a vector and the rotations are computed with
+ * @ref sincos_complex, so they do not accumulate errors. Other architectures do not implement sincos_complex, so the
+ * rotation of each lane is split into a constant rotation by its offset within the block, computed when the phase is
+ * set, and a rotation by the phase of the block that is shared by all lanes. The latter is updated with a scalar phase
+ * recurrence in Q.30, followed by a first-order normalization so that rounding errors do not make the amplitude of the
+ * signal grow or decay over time, and each block only takes one vector multiplication. The phase of the recurrence
+ * drifts by about 1e-4 radians every 10^6 blocks, so very long-running oscillators can call set_phase with the value
+ * returned by phase to resynchronize it.
+ *
+ * @tparam Lanes Number of rotations generated in each call to rotations.
+ */
+template <unsigned Lanes>
+    requires(Lanes >= 4 && detail::utils::is_powerof2(Lanes))
+class nco
+{
+public:
+    /** Number of rotations generated in each call to rotations */
+    static constexpr unsigned lanes = Lanes;
+
+    /**
+     * Creates an oscillator.
+     *
+     * @param delta Phase increment between consecutive samples. 2^32 is a full turn.
+     * @param phase Phase of the first sample. 2^32 is a full turn.
+     */
+    explicit nco(uint32 delta, uint32 phase = 0)
+    {
+        set_frequency(delta, phase);
+    }
+
+    /**
+     * Changes the phase increment between consecutive samples and restarts the oscillator at the given phase.
+     *
+     * @param delta Phase increment between consecutive samples. 2^32 is a full turn.
+     * @param phase Phase of the next sample. 2^32 is a full turn.
+     */
+    void set_frequency(uint32 delta, uint32 phase)
+    {
+        delta_ = delta;
+        set_phase(phase);
+    }
+
+    /**
+     * Restarts the oscillator at the given phase, without changing the phase increment.
+     *
+     * @param phase Phase of the next sample. 2^32 is a full turn.
+     */
+    void set_phase(uint32 phase)
+    {
+        phase_ = phase;
+
+#if __AIE_ARCH__ == 10
+        for (unsigned i = 0; i < Lanes; ++i)
+            phases_.set(int32(phase + i * delta_), i);
+#else
+        for (unsigned i = 0; i < Lanes; ++i) {
+            const auto [c, s] = rotation<int16>(i * delta_, 15);
+            offsets_.set(cint16{c, s}, i);
+        }
+
+        block_ = rotation<int64_t>(phase,         30);
+        step_  = rotation<int64_t>(Lanes * delta_, 30);
+#endif
+    }
+
+    /**
+     * Returns the phase of the next sample. 2^32 is a full turn.
+     */
+    uint32 phase() const
+    {
+        return phase_;
+    }
+
+    /**
+     * Returns the phase increment between consecutive samples. 2^32 is a full turn.
+     */
+    uint32 frequency() const
+    {
+        return delta_;
+    }
+
+    /**
+     * Returns the rotations of the next block of Lanes samples, in cint16 Q.15 (cos in the real part, sin in the
+     * imaginary part), and advances the oscillator to the following block.
+     */
+    __aie_inline
+    vector<cint16, Lanes> rotations()
+    {
+        phase_ += Lanes * delta_;
+
+#if __AIE_ARCH__ == 10
+        const vector<cint16, Lanes> ret = sincos_complex(phases_);
+
+        phases_ = add(phases_, int32(Lanes * delta_));
+#else
+        const cint16 block = {to_q15(block_.first), to_q15(block_.second)};
+
+        const vector<cint16, Lanes> ret = mul(offsets_, block).template to_vector<cint16>(15);
+
+        const int64_t re = round_shift(block_.first * step_.first  - block_.second * step_.second, 30);
+        const int64_t im = round_shift(block_.first * step_.second + block_.second * step_.first,  30);
+
+        // Newton step towards |r| = 1: r * (3 - |r|^2) / 2
+        const int64_t gain = (int64_t(3) << 30) - round_shift(re * re + im * im, 30);
+
+        block_ = {round_shift(re * gain, 31), round_shift(im * gain, 31)};
+#endif
+
+        return ret;
+    }
+
+    /**
+     * Multiplies a block of Lanes samples by the rotations of the next block and returns the accumulated products.
+     *
+     * @param samples Block of Lanes input samples.
+     */
+    template <ElemBaseType DataType>
+        requires(is_valid_mul_op_v<DataType, cint16>)
+    __aie_inline
+    auto mix(const vector<DataType, Lanes> &samples)
+    {
+        return mul(samples, rotations());
+    }
+
+    /**
+     * Mixes a block of samples and writes the outputs, converted to OutType.
+     *
+     * @param in    Input samples.
+     * @param out   Output samples.
+     * @param n     Number of samples. It must be a multiple of Lanes.
+     * @param shift Shift applied to the accumulated products when they are converted to OutType. The rotations are in
+     *              Q.15, so a shift of 15 keeps the scale of the input.
+     */
+    template <ElemBaseType DataType, ElemBaseType OutType>
+        requires(is_valid_mul_op_v<DataType, cint16>)
+    void run(const DataType * __restrict in, OutType * __restrict out, unsigned n, int shift = 15)
+    {
+        for (unsigned i = 0; i < n / Lanes; ++i)
+            chess_prepare_for_pipelining
+        {
+            const auto acc = mix(load_v<Lanes>(in + i * Lanes));
+
+            store_v(out + i * Lanes, acc.template to_vector<OutType>(shift));
+        }
+    }
+
+private:
+#if __AIE_ARCH__ != 10
+    template <typename T>
+    static constexpr std::pair<T, T> rotation(uint32 phase, unsigned shift)
+    {
+        const auto [c, s] = detail::constexpr_math::cos_sin_turns(phase, uint64_t(1) << 32);
+
+        return {detail::constexpr_math::to_fixed<T>(c, shift), detail::constexpr_math::to_fixed<T>(s, shift)};
+    }
+
+    static constexpr int64_t round_shift(int64_t v, unsigned shift)
+    {
+        return (v + (int64_t(1) << (shift - 1))) >> shift;
+    }
+
+    static constexpr int16 to_q15(int64_t v)
+    {
+        return int16(std::min(round_shift(v, 15), int64_t(32767)));
+    }
+#endif
+
+    uint32 delta_;
+    uint32 phase_;
+
+#if __AIE_ARCH__ == 10
+    vector<int32, Lanes>        phases_;
+#else
+    // Rotations by the offset of each lane within the block, in Q.15
+    vector<cint16, Lanes>       offsets_;
+    // Rotation by the phase of the current block and by the phase increment of a block, in Q.30
+    std::pair<int64_t, int64_t> block_;
+    std::pair<int64_t, int64_t> step_;
+#endif
+};
+
+} // namespace aie
+
+#endif
@@ -0,0 +1,190 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2022 Xilinx, Inc.
+// Copyright (C) 2022-2026 Advanced Micro Devices, Inc.
+
+/**
+ * @file
+ * @brief Layer normalization and RMS normalization with single-pass statistics and a fused affine transform.
+ */
+
+#pragma once
+
+#ifndef __AIE_API_NORMALIZATION__HPP__
+#define __AIE_API_NORMALIZATION__HPP__
+
+#include "softmax.hpp"
+
+// bfloat16 is only available from AIE-ML
+#if AIE_API_ML_VERSION >= 200
+
+namespace aie {
+
+namespace detail {
+
+// Sums of the values of a row and of their squares, relative to the given shift, accumulated per lane and reduced at
+// the end of the row. The deviations from the shift are not bfloat16 values, so each of them is split in two bfloat16
+// vectors to square it with 16 bits of mantissa: d^2 = hi^2 + 2 * hi * lo, up to lo^2 < 2^-16 * d^2.
+template <unsigned Elems, typename T>
+static std::pair<float, float> norm_moments(const T * __restrict in, unsigned len, T shift)
+{
+    accum<accfloat, Elems> sum    = zeros<accfloat, Elems>();
+    accum<accfloat, Elems> sum_sq = zeros<accfloat, Elems>();
+
+    for (unsigned i = 0; i < len / Elems; ++i)
+        chess_prepare_for_pipelining
+    {
+        const accum<accfloat, Elems> d = sub(accum<accfloat, Elems>(load_v<Elems>(in + i * Elems)), shift);
+
+        const vector<bfloat16, Elems> hi = d.template to_vector<bfloat16>();
+        const vector<bfloat16, Elems> lo = sub(d, hi).template to_vector<bfloat16>();
+
+        sum    = add(sum, d);
+        sum_sq = mac(mac(mac(sum_sq, hi, hi), hi, lo), hi, lo);
+    }
+
+    return {reduce_add<float>(sum), reduce_add<float>(sum_sq)};
+}
+
+// Sum of the squares of the values of a row. The values are squared exactly, as they are not shifted.
+template <unsigned Elems, typename T>
+static float norm_sum_squares(const T * __restrict in, unsigned len)
+{
+    accum<accfloat, Elems> sum_sq = zeros<accfloat, Elems>();
+
+    for (unsigned i = 0; i < len / Elems; ++i)
+        chess_prepare_for_pipelining
+    {
+        const vector<T, Elems> v = load_v<Elems>(in + i * Elems);
+
+        sum_sq = mac(sum_sq, v, v);
+    }
+
+    return reduce_add<float>(sum_sq);
+}
+
+} // namespace detail
+
+/**
+ * @ingroup group_elementary
+ *
+ * Computes the layer normalization of a row of values:
+ *
+ * @code
+ * mean   = sum(in[j]) / len
+ * var    = sum((in[j] - mean)^2) / len
+ * out[i] = (in[i] - mean) / sqrt(var + epsilon) * gamma[i] + beta[i]
+ * @endcode
+ *
+ * The row is read twice. The first pass computes the sum of the values and the sum of their squares together, in
+ * accfloat accumulators. Both sums are taken relative to the first value of the row, which keeps the variance accurate
+ * when the mean is large compared to the deviation, like Welford's algorithm, without a division per element. The
+ * deviations are squared with 16 bits of mantissa, as two bfloat16 halves. The inverse of the standard deviation is
+ * computed with @ref invsqrt. The second pass applies the normalization and the gamma/beta affine transform with a
+ * single multiply-accumulate per value:
+ *
+ * @code
+ * scale  = gamma[i] * invstd
+ * out[i] = in[i] * scale + (beta[i] - mean * scale)
+ * @endcode
+ *
+ * The scale is rounded to bfloat16 once and the shift is computed in the accumulator, so the mean cancels with float
+ * precision.
+ *
+ * @code
+ * // Normalizes the hidden state of each token
+ * for (unsigned t = 0; t < tokens; ++t)
+ *     aie::layer_norm<bfloat16, 32>(x + t * hidden, gamma, beta, y + t * hidden, hidden);
+ * @endcode
+ *
+ * @param in      Input values. It must be aligned to the size of a vector of Elems elements.
+ * @param gamma   Per-element scales. It must be aligned to the size of a vector of Elems elements.
+ * @param beta    Per-element offsets. It must be aligned to the size of a vector of Elems elements.
+ * @param out     Output values. It must be aligned to the size of a vector of Elems elements. It may be the same as in.
+ * @param len     Number of values in the row. It must be a multiple of Elems.
+ * @param epsilon Value added to the variance.
+ *
+ * @tparam T     Type of the input and output values, and of gamma and beta.
+ * @tparam Elems Number of values processed in each iteration.
+ */
+template <ElemBaseType T, unsigned Elems = 16>
+    requires(arch::is(arch::Gen2) && std::is_same_v<T, bfloat16> && Elems >= 16 && detail::utils::is_powerof2(Elems))
+void layer_norm(const T *in, const T * __restrict gamma, const T * __restrict beta, T *out, unsigned len,
+                float epsilon = 1e-5f)
+{
+    REQUIRES_MSG(len % Elems == 0, "The length of the row must be a multiple of Elems");
+
+    const T shift = in[0];
+
+    const std::pair<float, float> moments = detail::norm_moments<Elems>(in, len, shift);
+
+    const float inv_len = inv(float(len));
+    const float offset  = moments.first * inv_len;
+    const float var     = std::max(moments.second * inv_len - offset * offset, 0.0f);
+
+    const std::pair<bfloat16, bfloat16> invstd = detail::bfloat16_split(invsqrt(var + epsilon));
+    const std::pair<bfloat16, bfloat16> mean   = detail::bfloat16_split(float(shift) + offset);
+
+    for (unsigned i = 0; i < len / Elems; ++i)
+        chess_prepare_for_pipelining
+    {
+        const vector<T, Elems> g = load_v<Elems>(gamma + i * Elems);
+
+        const vector<bfloat16, Elems> scale = mac(mul(g, invstd.first), g, invstd.second)
+                                                  .template to_vector<bfloat16>();
+
+        auto acc = msc(msc(accum<accfloat, Elems>(load_v<Elems>(beta + i * Elems)), scale, mean.first),
+                       scale, mean.second);
+        acc      = mac(acc, load_v<Elems>(in + i * Elems), scale);
+
+        store_v(out + i * Elems, acc.template to_vector<T>());
+    }
+}
+
+/**
+ * @ingroup group_elementary
+ *
+ * Computes the RMS normalization of a row of values:
+ *
+ * @code
+ * out[i] = in[i] / sqrt(sum(in[j]^2) / len + epsilon) * gamma[i]
+ * @endcode
+ *
+ * The first pass accumulates the squares of the values in accfloat, and the inverse of the root mean square is
+ * computed with @ref invsqrt. The second pass multiplies each value by gamma and the inverse, rounded to bfloat16 once.
+ *
+ * @param in      Input values. It must be aligned to the size of a vector of Elems elements.
+ * @param gamma   Per-element scales. It must be aligned to the size of a vector of Elems elements.
+ * @param out     Output values. It must be aligned to the size of a vector of Elems elements. It may be the same as in.
+ * @param len     Number of values in the row. It must be a multiple of Elems.
+ * @param epsilon Value added to the mean square.
+ *
+ * @tparam T     Type of the input and output values, and of gamma.
+ * @tparam Elems Number of values processed in each iteration.
+ */
+template <ElemBaseType T, unsigned Elems = 16>
+    requires(arch::is(arch::Gen2) && std::is_same_v<T, bfloat16> && Elems >= 16 && detail::utils::is_powerof2(Elems))
+void rms_norm(const T *in, const T * __restrict gamma, T *out, unsigned len, float epsilon = 1e-5f)
+{
+    REQUIRES_MSG(len % Elems == 0, "The length of the row must be a multiple of Elems");
+
+    const float sum_sq = detail::norm_sum_squares<Elems>(in, len);
+
+    const std::pair<bfloat16, bfloat16> invrms = detail::bfloat16_split(invsqrt(sum_sq * inv(float(len)) + epsilon));
+
+    for (unsigned i = 0; i < len / Elems; ++i)
+        chess_prepare_for_pipelining
+    {
+        const vector<T, Elems> g = load_v<Elems>(gamma + i * Elems);
+
+        const vector<bfloat16, Elems> scale = mac(mul(g, invrms.first), g, invrms.second)
+                                                  .template to_vector<bfloat16>();
+
+        store_v(out + i * Elems, mul(load_v<Elems>(in + i * Elems), scale).template to_vector<T>());
+    }
+}
+
+} // namespace aie
+
+#endif // AIE_API_ML_VERSION
+
+#endif
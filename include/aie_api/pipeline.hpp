@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2022 Xilinx, Inc.
+// Copyright (C) 2022-2026 Advanced Micro Devices, Inc.
+
+/**
+ * @file
+ * @brief Producer-consumer pipelines over synchronized buffers.
+ */
+
+#pragma once
+
+#ifndef __AIE_API_PIPELINE__HPP__
+#define __AIE_API_PIPELINE__HPP__
+
+#include <tuple>
+#include <type_traits>
+
+#include "detail/sync_buffer.hpp"
+
+namespace aie {
+
+namespace detail::sync {
+
+template <typename T>
+struct is_input : std::false_type {};
+
+template <typename Span, unsigned NumBuffers, unsigned NumReaders, unsigned NumWriters, typename Indices>
+struct is_input<sync_data_impl<direction::Input, Span, NumBuffers, NumReaders, NumWriters, Indices>> : std::true_type {};
+
+template <typename T>
+static constexpr bool is_input_v = is_input<std::remove_cvref_t<T>>::value;
+
+} // namespace detail::sync
+
+/**
+ * @ingroup group_pipeline
+ *
+ * Runs a kernel over a set of synchronized input and output buffers (sync::buffered_input and sync::buffered_output).
+ *
+ * Each step acquires the current buffer of every input and output, calls the kernel with them and releases them, so
+ * the next call works on the next buffer of each rotation. While the kernel works on buffer i, the producers of the
+ * inputs and the consumers of the outputs work on the other buffers, so with two or more buffers the transfers overlap
+ * with the computation.
+ *
+ * To keep the time the buffers are held to a minimum, buffers are acquired in the order in which they are given, which
+ * should list inputs first, and outputs are released before inputs, which lets the downstream kernels start as soon as
+ * possible.
+ *
+ * Buffers with several readers or writers use one semaphore per peer (see sync::producer_sem and sync::consumer_sem),
+ * which allows fanning out the output of a kernel to several consumer kernels, or gathering the outputs of several
+ * producer kernels.
+ *
+ * See @ref group_pipeline for an example.
+ *
+ * @tparam Buffers Types of the synchronized buffers.
+ */
+template <typename... Buffers>
+class pipeline
+{
+public:
+    /**
+     * @param buffers Synchronized buffers, passed to the kernel in the same order.
+     */
+    explicit pipeline(Buffers &...buffers) :
+        buffers_(buffers...)
+    {
+    }
+
+    /**
+     * Runs one step of the pipeline.
+     *
+     * @param fn Kernel, called with the acquired buffers.
+     */
+    template <typename Fn>
+    void step(Fn &&fn)
+    {
+        std::apply([&](Buffers &...buffers) {
+            // Braced initialization evaluates the acquires in order
+            std::tuple<decltype(buffers.acquire())...> acquired{buffers.acquire()...};
+
+            std::apply(fn, acquired);
+
+            (release_if<false>(buffers), ...);
+            (release_if<true>(buffers), ...);
+        }, buffers_);
+    }
+
+    /**
+     * Runs the given number of steps of the pipeline.
+     *
+     * @param iterations Number of steps.
+     * @param fn         Kernel, called with the acquired buffers at each step.
+     */
+    template <typename Fn>
+    void run(unsigned iterations, Fn &&fn)
+    {
+        for (unsigned i = 0; i < iterations; ++i)
+            step(fn);
+    }
+
+private:
+    template <bool Input, typename Buffer>
+    static void release_if(Buffer &buffer)
+    {
+        if constexpr (detail::sync::is_input_v<Buffer> == Input)
+            buffer.release();
+    }
+
+    std::tuple<Buffers &...> buffers_;
+};
+
+} // namespace aie
+
+#endif
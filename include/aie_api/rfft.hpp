@@ -0,0 +1,286 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2022 Xilinx, Inc.
+// Copyright (C) 2022-2026 Advanced Micro Devices, Inc.
+
+/**
+ * @file
+ * @brief FFTs of real signals, computed as complex FFTs of half the size.
+ */
+
+#pragma once
+
+#ifndef __AIE_API_RFFT__HPP__
+#define __AIE_API_RFFT__HPP__
+
+namespace aie {
+
+/**
+ * @ingroup group_fft
+ *
+ * Computes the FFT of N real samples.
+ *
+ * The samples are reinterpreted as N / 2 complex values (even samples in the real parts and odd samples in the
+ * imaginary parts) and transformed with an N / 2 point fft_plan. A final pass splits the result into the first half of
+ * the spectrum of the real signal:
+ *
+ * @code
+ * X[k] = A[k] * Z[k] + B[k] * conj(Z[N / 2 - k]),  A[k] = (1 - j * exp(-2j * pi * k / N)) / 2,  B[k] = 1 - A[k]
+ * @endcode
+ *
+ * This takes roughly half the computation and memory of promoting the samples to complex values and running an N
+ * point transform. The second half of the spectrum is the conjugate mirror of the first one and is not computed.
+ *
+ * The output holds the N / 2 bins from 0 to N / 2 - 1. Bins 0 and N / 2 are real, so the real part of the Nyquist
+ * bin N / 2 is returned in the imaginary part of bin 0.
+ *
+ * @tparam N            Number of real samples. N / 2 must be supported by fft_plan.
+ * @tparam Input        Type of the real input samples.
+ * @tparam Output       Type of the output bins. Defaults to the complex counterpart of the input type.
+ * @tparam Twiddle      Type of twiddle factors.
+ * @tparam TwiddleShift Decimal point of the generated twiddles.
+ *
+ * @sa irfft_plan
+ */
+template <unsigned N, typename Input, typename Output = detail::add_complex_t<Input>,
+          typename Twiddle = detail::default_twiddle_type_t<detail::add_complex_t<Input>, Output>,
+          unsigned TwiddleShift = detail::fft_default_twiddle_shift_v<Twiddle>>
+    requires(!detail::is_complex_v<Input> && detail::is_complex_v<Output>)
+class rfft_plan
+{
+    using complex_input_type = detail::add_complex_t<Input>;
+    using coefficients       = detail::rfft_coefficients<N, Twiddle, TwiddleShift>;
+
+    static constexpr unsigned Lanes = 256 / detail::type_bits_v<Output>;
+
+    static_assert(N % 2 == 0 && (N / 2) % Lanes == 0, "The real FFT size must be a multiple of twice the split pass vector size");
+
+public:
+    /** Complex FFT used on the packed samples */
+    using fft_type          = fft_plan<N / 2, complex_input_type, Output, Twiddle, TwiddleShift>;
+
+    using input_type        = Input;
+    using output_type       = Output;
+    using twiddle_type      = Twiddle;
+    using intermediate_type = typename fft_type::intermediate_type;
+
+    /** Number of real samples of the transform */
+    static constexpr unsigned size         = N;
+    /** Minimum number of elements of type intermediate_type of the scratch buffer given to run */
+    static constexpr unsigned scratch_size = fft_type::scratch_size + N / 2;
+
+    /**
+     * Computes the FFT of the real samples.
+     *
+     * @param x     Input data pointer, N real samples
+     * @param shift Additional shift applied to the outputs of every stage of the complex FFT
+     * @param tmp   Scratch buffer of at least scratch_size elements
+     * @param out   Output data pointer, N / 2 bins
+     */
+    __aie_fft_inline
+    static void run(const Input * __restrict x, unsigned shift,
+                    intermediate_type * __restrict tmp, Output * __restrict out)
+        requires(!detail::is_floating_point_v<Input>)
+    {
+        // The packed transform is kept apart from the output, as the split pass reads it in mirrored order
+        Output *z = (Output *)(tmp + fft_type::scratch_size);
+
+        fft_type::run((const complex_input_type *)x, shift, false, tmp, z);
+        split(z, out);
+    }
+
+    /**
+     * Computes the floating point FFT of the real samples.
+     *
+     * @param x     Input data pointer, N real samples
+     * @param tmp   Scratch buffer of at least scratch_size elements
+     * @param out   Output data pointer, N / 2 bins
+     */
+    __aie_fft_inline
+    static void run(const Input * __restrict x,
+                    intermediate_type * __restrict tmp, Output * __restrict out)
+        requires(detail::is_floating_point_v<Input>)
+    {
+        Output *z = (Output *)(tmp + fft_type::scratch_size);
+
+        fft_type::run((const complex_input_type *)x, false, tmp, z);
+        split(z, out);
+    }
+
+private:
+    __aie_inline
+    static void split(const Output * __restrict z, Output * __restrict out)
+    {
+        using component_type = detail::remove_complex_t<Output>;
+
+        auto it_z   = cbegin_restrict_vector<Lanes>(z);
+        auto it_a   = cbegin_restrict_vector<Lanes>(coefficients::a());
+        auto it_b   = cbegin_restrict_vector<Lanes>(coefficients::b());
+        auto it_out = begin_restrict_vector<Lanes>(out);
+
+        // Z[N / 2 - k] is read backwards from the end of the transform, and Z[N / 2] wraps around to Z[0]
+        const Output *p = z + N / 2;
+        vector<Output, Lanes> next = load_v<Lanes>(z);
+
+        for (unsigned i = 0; i < N / (2 * Lanes); ++i)
+            chess_prepare_for_pipelining
+            chess_loop_range(1,)
+        {
+            p -= Lanes;
+            const vector<Output, Lanes> cur    = load_v<Lanes>(p);
+            const vector<Output, Lanes> mirror = reverse(shuffle_down_fill(cur, next, 1));
+            next = cur;
+
+            const auto acc = mac(mul(*it_z++, *it_a++), op_conj(mirror), *it_b++);
+
+            if constexpr (detail::is_floating_point_v<Output>)
+                *it_out++ = acc.template to_vector<Output>();
+            else
+                *it_out++ = acc.template to_vector<Output>(TwiddleShift);
+        }
+
+        // Pack the DC and Nyquist bins, which are both real, into the first bin
+        const Output z0 = z[0];
+
+        if constexpr (detail::is_floating_point_v<Output>) {
+            out[0] = Output{z0.real + z0.imag, z0.real - z0.imag};
+        }
+        else {
+            constexpr int64_t lo = std::numeric_limits<component_type>::min();
+            constexpr int64_t hi = std::numeric_limits<component_type>::max();
+
+            out[0] = Output{component_type(std::clamp<int64_t>(int64_t(z0.real) + z0.imag, lo, hi)),
+                            component_type(std::clamp<int64_t>(int64_t(z0.real) - z0.imag, lo, hi))};
+        }
+    }
+};
+
+/**
+ * @ingroup group_fft
+ *
+ * Computes the inverse FFT of the spectrum of a real signal, returning N real samples.
+ *
+ * The input has the layout produced by rfft_plan: the N / 2 bins from 0 to N / 2 - 1, with the real part of the
+ * Nyquist bin N / 2 in the imaginary part of bin 0. A first pass merges the bins into the spectrum of the samples
+ * packed as N / 2 complex values, which is then transformed with an N / 2 point inverse fft_plan.
+ *
+ * Like the inverse transforms of fft_plan, the result is not normalized: the samples are scaled by N / 2 in addition to
+ * the shifts that are applied.
+ *
+ * @tparam N            Number of real samples. N / 2 must be supported by fft_plan.
+ * @tparam Input        Type of the input bins.
+ * @tparam Output       Type of the real output samples. Defaults to the real counterpart of the input type.
+ * @tparam Twiddle      Type of twiddle factors.
+ * @tparam TwiddleShift Decimal point of the generated twiddles.
+ *
+ * @sa rfft_plan
+ */
+template <unsigned N, typename Input, typename Output = detail::remove_complex_t<Input>,
+          typename Twiddle = detail::default_twiddle_type_t<Input, detail::add_complex_t<Output>>,
+          unsigned TwiddleShift = detail::fft_default_twiddle_shift_v<Twiddle>>
+    requires(detail::is_complex_v<Input> && !detail::is_complex_v<Output>)
+class irfft_plan
+{
+    using complex_output_type = detail::add_complex_t<Output>;
+    using coefficients        = detail::rfft_coefficients<N, Twiddle, TwiddleShift>;
+
+    static constexpr unsigned Lanes = 256 / detail::type_bits_v<Input>;
+
+    static_assert(N % 2 == 0 && (N / 2) % Lanes == 0, "The real FFT size must be a multiple of twice the merge pass vector size");
+
+public:
+    /** Complex inverse FFT used to compute the packed samples */
+    using fft_type          = fft_plan<N / 2, Input, complex_output_type, Twiddle, TwiddleShift>;
+
+    using input_type        = Input;
+    using output_type       = Output;
+    using twiddle_type      = Twiddle;
+    using intermediate_type = typename fft_type::intermediate_type;
+
+    /** Number of real samples of the transform */
+    static constexpr unsigned size         = N;
+    /** Minimum number of elements of type intermediate_type of the scratch buffer given to run */
+    static constexpr unsigned scratch_size = fft_type::scratch_size + N / 2;
+
+    /**
+     * Computes the inverse FFT.
+     *
+     * @param x     Input data pointer, N / 2 bins
+     * @param shift Additional shift applied to the outputs of every stage of the complex FFT
+     * @param tmp   Scratch buffer of at least scratch_size elements
+     * @param out   Output data pointer, N real samples
+     */
+    __aie_fft_inline
+    static void run(const Input * __restrict x, unsigned shift,
+                    intermediate_type * __restrict tmp, Output * __restrict out)
+        requires(!detail::is_floating_point_v<Input>)
+    {
+        Input *z = (Input *)(tmp + fft_type::scratch_size);
+
+        merge(x, z);
+        fft_type::run(z, shift, true, tmp, (complex_output_type *)out);
+    }
+
+    /**
+     * Computes the floating point inverse FFT.
+     *
+     * @param x     Input data pointer, N / 2 bins
+     * @param tmp   Scratch buffer of at least scratch_size elements
+     * @param out   Output data pointer, N real samples
+     */
+    __aie_fft_inline
+    static void run(const Input * __restrict x,
+                    intermediate_type * __restrict tmp, Output * __restrict out)
+        requires(detail::is_floating_point_v<Input>)
+    {
+        Input *z = (Input *)(tmp + fft_type::scratch_size);
+
+        merge(x, z);
+        fft_type::run(z, true, tmp, (complex_output_type *)out);
+    }
+
+private:
+    // Inverse of the split pass of rfft_plan: Z[k] = conj(A[k]) * X[k] + conj(B[k]) * conj(X[N / 2 - k])
+    __aie_inline
+    static void merge(const Input * __restrict x, Input * __restrict z)
+    {
+        using component_type = detail::remove_complex_t<Input>;
+
+        auto it_x = cbegin_restrict_vector<Lanes>(x);
+        auto it_a = cbegin_restrict_vector<Lanes>(coefficients::a());
+        auto it_b = cbegin_restrict_vector<Lanes>(coefficients::b());
+        auto it_z = begin_restrict_vector<Lanes>(z);
+
+        const Input *p = x + N / 2;
+        vector<Input, Lanes> next = load_v<Lanes>(x);
+
+        for (unsigned i = 0; i < N / (2 * Lanes); ++i)
+            chess_prepare_for_pipelining
+            chess_loop_range(1,)
+        {
+            p -= Lanes;
+            const vector<Input, Lanes> cur    = load_v<Lanes>(p);
+            const vector<Input, Lanes> mirror = reverse(shuffle_down_fill(cur, next, 1));
+            next = cur;
+
+            const auto acc = mac(mul(*it_x++, conj(*it_a++)), op_conj(mirror), conj(*it_b++));
+
+            if constexpr (detail::is_floating_point_v<Input>)
+                *it_z++ = acc.template to_vector<Input>();
+            else
+                *it_z++ = acc.template to_vector<Input>(TwiddleShift);
+        }
+
+        // Unpack the DC and Nyquist bins
+        const Input x0 = x[0];
+
+        if constexpr (detail::is_floating_point_v<Input>)
+            z[0] = Input{(x0.real + x0.imag) / 2, (x0.real - x0.imag) / 2};
+        else
+            z[0] = Input{component_type((int64_t(x0.real) + x0.imag) >> 1),
+                         component_type((int64_t(x0.real) - x0.imag) >> 1)};
+    }
+};
+
+} // namespace aie
+
+#endif
@@ -0,0 +1,278 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2022 Xilinx, Inc.
+// Copyright (C) 2022-2026 Advanced Micro Devices, Inc.
+
+/**
+ * @file
+ * @brief Softmax and log-softmax computed in two passes with an online maximum.
+ */
+
+#pragma once
+
+#ifndef __AIE_API_SOFTMAX__HPP__
+#define __AIE_API_SOFTMAX__HPP__
+
+#include <bit>
+
+// bfloat16 is only available from AIE-ML
+#if AIE_API_ML_VERSION >= 200
+
+namespace aie {
+
+namespace detail {
+
+// Value used for the lanes of partial blocks that are past the end of the row. Its exponential is zero, and subtracting
+// any other value from it does not overflow.
+static constexpr float softmax_padding = -0x1p100f;
+
+// Splits a value in two bfloat16 values whose sum is the value with float precision, so that multiplications by the
+// value can be computed with two bfloat16 multiplications.
+__aie_inline
+static inline std::pair<bfloat16, bfloat16> bfloat16_split(float a)
+{
+    const bfloat16 hi = bfloat16(a);
+
+    return {hi, bfloat16(a - float(hi))};
+}
+
+// Multiplies an accumulator by a vector of bfloat16 factors. The accumulator is split in two bfloat16 vectors, which
+// keeps 16 bits of mantissa.
+template <unsigned Elems>
+__aie_inline
+static accum<accfloat, Elems> softmax_rescale(const accum<accfloat, Elems> &acc, const vector<bfloat16, Elems> &f)
+{
+    const vector<bfloat16, Elems> hi = acc.template to_vector<bfloat16>();
+    const vector<bfloat16, Elems> lo = sub(acc, hi).template to_vector<bfloat16>();
+
+    return mac(mul(hi, f), lo, f);
+}
+
+// Base 2 logarithm of a positive normal value, with an absolute error of about 1.5e-5
+__aie_inline
+static inline float softmax_log2(float a)
+{
+    const uint32 bits = std::bit_cast<uint32>(a);
+    const float  t    = std::bit_cast<float>((bits & 0x007fffffu) | 0x3f800000u) - 1.0f;
+
+    const float p = t * (1.44196547f + t * (-0.70966148f + t * (0.41759188f + t * (-0.19626504f + t * 0.04638345f))));
+
+    return float(int(bits >> 23) - 127) + p;
+}
+
+// Running maximum and sum of exponentials of a row, in base 2. Each lane keeps its own maximum, so that no reductions
+// are needed until the end of the row, and the sum of a lane is only rescaled when its maximum grows, which happens
+// rarely after the first blocks of a row.
+//
+// Float vectors have no native adders or comparators, so the scaled values are kept in accumulators and the maximum is
+// kept in bfloat16. The maximum is only an offset that keeps the exponentials in range, so the rounding of the maximum
+// does not change the result as long as the same offset is used for all the values.
+template <typename T, unsigned Elems>
+class softmax_state
+{
+public:
+    using accum_type = accum<accfloat, Elems>;
+
+    softmax_state() :
+        max_(broadcast<bfloat16, Elems>(bfloat16(softmax_padding))),
+        sum_(zeros<accfloat, Elems>())
+    {
+        const auto [hi, lo] = bfloat16_split(1.4426950408889634f);
+
+        log2e_hi_ = hi;
+        log2e_lo_ = lo;
+    }
+
+    // Returns the values multiplied by log2(e), with float precision
+    __aie_inline
+    accum_type scale(const vector<T, Elems> &v) const
+    {
+        return mac(mul(v, log2e_hi_), v, log2e_lo_);
+    }
+
+    __aie_inline
+    void update(const accum_type &x)
+    {
+        const vector<bfloat16, Elems> rounded = x.template to_vector<bfloat16>();
+
+        if (!lt(max_, rounded).empty()) {
+            const vector<bfloat16, Elems> next = max(max_, rounded);
+
+            sum_ = softmax_rescale(sum_, exp2<bfloat16>(sub(accum_type(max_), next).template to_vector<float>()));
+            max_ = next;
+        }
+
+        sum_ = add(sum_, exp2<bfloat16>(sub(x, max_).template to_vector<float>()));
+    }
+
+    // Returns the maximum of the row and the sum of the exponentials relative to it, in base 2
+    __aie_inline
+    std::pair<bfloat16, float> finish() const
+    {
+        const bfloat16 m = reduce_max(max_);
+
+        const vector<bfloat16, Elems> f = exp2<bfloat16>(sub(accum_type(max_), m).template to_vector<float>());
+
+        return {m, reduce_add<float>(softmax_rescale(sum_, f))};
+    }
+
+private:
+    vector<bfloat16, Elems> max_;
+    accum_type              sum_;
+    bfloat16                log2e_hi_;
+    bfloat16                log2e_lo_;
+};
+
+// Loads the last n < Elems elements of a row, with the remaining lanes set to softmax_padding
+template <unsigned Elems, typename T>
+__aie_inline
+static vector<T, Elems> softmax_load_tail(const T *p, unsigned n)
+{
+    vector<T, Elems> ret = broadcast<T, Elems>(T(softmax_padding));
+
+    for (unsigned i = 0; i < n; ++i)
+        ret.set(p[i], i);
+
+    return ret;
+}
+
+template <unsigned Elems, typename T>
+__aie_inline
+static void softmax_store_tail(T *p, const vector<T, Elems> &v, unsigned n)
+{
+    for (unsigned i = 0; i < n; ++i)
+        p[i] = v.get(i);
+}
+
+// First pass over a row, which returns its maximum and the sum of the exponentials relative to it, in base 2
+template <unsigned Elems, typename T>
+static std::pair<bfloat16, float> softmax_reduce(const softmax_state<T, Elems> &init, const T * __restrict in,
+                                                 unsigned len)
+{
+    softmax_state<T, Elems> state = init;
+
+    const unsigned blocks = len / Elems;
+    const unsigned tail   = len % Elems;
+
+    for (unsigned i = 0; i < blocks; ++i)
+        chess_prepare_for_pipelining
+    {
+        state.update(state.scale(load_v<Elems>(in + i * Elems)));
+    }
+
+    if (tail)
+        state.update(state.scale(softmax_load_tail<Elems>(in + blocks * Elems, tail)));
+
+    return state.finish();
+}
+
+// Second pass over a row, which writes the values returned by fn for each block
+template <unsigned Elems, typename T, typename Fn>
+static void softmax_map(const T *in, T *out, unsigned len, Fn &&fn)
+{
+    const unsigned blocks = len / Elems;
+    const unsigned tail   = len % Elems;
+
+    for (unsigned i = 0; i < blocks; ++i)
+        chess_prepare_for_pipelining
+    {
+        store_v(out + i * Elems, fn(load_v<Elems>(in + i * Elems)));
+    }
+
+    if (tail)
+        softmax_store_tail(out + blocks * Elems, fn(softmax_load_tail<Elems>(in + blocks * Elems, tail)), tail);
+}
+
+} // namespace detail
+
+/**
+ * @ingroup group_elementary
+ *
+ * Computes the softmax of a row of values:
+ *
+ * @code
+ * out[i] = exp(in[i] - max(in)) / sum(exp(in[j] - max(in)))
+ * @endcode
+ *
+ * The row is read twice. The first pass keeps a running maximum per lane and the sum of the exponentials relative to
+ * it, which is rescaled when the maximum of a lane grows, so the result is numerically stable without a separate pass
+ * to find the maximum. The exponentials are computed with @ref exp2 on the values scaled by log2(e), which is applied
+ * with float precision, and they are summed in an accfloat accumulator. The second pass recomputes the exponentials
+ * and multiplies them by the inverse of the sum, computed with @ref inv.
+ *
+ * Rows whose length is not a multiple of Elems are supported: the last partial block is read and written element by
+ * element.
+ *
+ * @code
+ * // Attention scores, one row per query
+ * for (unsigned q = 0; q < queries; ++q)
+ *     aie::softmax<bfloat16, 32>(scores + q * keys, probs + q * keys, keys);
+ * @endcode
+ *
+ * @param in  Input values. It must be aligned to the size of a vector of Elems elements.
+ * @param out Output values. It must be aligned to the size of a vector of Elems elements. It may be the same as in.
+ * @param len Number of values in the row.
+ *
+ * @tparam T     Type of the input and output values.
+ * @tparam Elems Number of values processed in each iteration.
+ */
+template <ElemBaseType T, unsigned Elems = 16>
+    requires(arch::is(arch::XDNA2, arch::AIE_MLv2) && std::is_same_v<T, bfloat16> && Elems >= 16 &&
+             detail::utils::is_powerof2(Elems))
+void softmax(const T *in, T *out, unsigned len)
+{
+    const detail::softmax_state<T, Elems> state;
+
+    const std::pair<bfloat16, float> reduced = detail::softmax_reduce<Elems>(state, in, len);
+
+    const bfloat16 m = reduced.first;
+    const std::pair<bfloat16, bfloat16> scale = detail::bfloat16_split(inv(reduced.second));
+
+    detail::softmax_map<Elems>(in, out, len, [&](const vector<T, Elems> &v) __aie_inline {
+        const vector<bfloat16, Elems> e = exp2<bfloat16>(sub(state.scale(v), m).template to_vector<float>());
+
+        return mac(mul(e, scale.first), e, scale.second).template to_vector<T>();
+    });
+}
+
+/**
+ * @ingroup group_elementary
+ *
+ * Computes the logarithm of the softmax of a row of values:
+ *
+ * @code
+ * out[i] = in[i] - max(in) - log(sum(exp(in[j] - max(in))))
+ * @endcode
+ *
+ * The first pass is the same as in @ref softmax. The second pass subtracts the same offset from all the values, so it
+ * does not compute any exponentials.
+ *
+ * @param in  Input values. It must be aligned to the size of a vector of Elems elements.
+ * @param out Output values. It must be aligned to the size of a vector of Elems elements. It may be the same as in.
+ * @param len Number of values in the row.
+ *
+ * @tparam T     Type of the input and output values.
+ * @tparam Elems Number of values processed in each iteration.
+ */
+template <ElemBaseType T, unsigned Elems = 16>
+    requires(arch::is(arch::XDNA2, arch::AIE_MLv2) && std::is_same_v<T, bfloat16> && Elems >= 16 &&
+             detail::utils::is_powerof2(Elems))
+void log_softmax(const T *in, T *out, unsigned len)
+{
+    const detail::softmax_state<T, Elems> state;
+
+    const std::pair<bfloat16, float> reduced = detail::softmax_reduce<Elems>(state, in, len);
+
+    // Back from base 2 to natural logarithms
+    const std::pair<bfloat16, bfloat16> offset =
+        detail::bfloat16_split((float(reduced.first) + detail::softmax_log2(reduced.second)) * 0.6931471805599453f);
+
+    detail::softmax_map<Elems>(in, out, len, [&](const vector<T, Elems> &v) __aie_inline {
+        return sub(sub(accum<accfloat, Elems>(v), offset.first), offset.second).template to_vector<T>();
+    });
+}
+
+} // namespace aie
+
+#endif // AIE_API_ML_VERSION
+
+#endif
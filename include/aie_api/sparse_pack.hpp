@@ -0,0 +1,231 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2022 Xilinx, Inc.
+// Copyright (C) 2022-2026 Advanced Micro Devices, Inc.
+
+/**
+ * @file
+ * @brief Conversion of dense data into the compressed layout read by sparse vector buffer streams.
+ */
+
+#pragma once
+
+#ifndef __AIE_API_SPARSE_PACK__HPP__
+#define __AIE_API_SPARSE_PACK__HPP__
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "concepts.hpp"
+#include "detail/config.hpp"
+#include "detail/ld_st.hpp"
+#include "detail/utils.hpp"
+
+namespace aie {
+
+/**
+ * @ingroup group_memory
+ *
+ * Summary of a sparse_pack conversion.
+ */
+struct sparse_pack_result
+{
+    /** Whether the dense data met the sparsity constraint. The packed data is only usable if this is true. */
+    bool     valid;
+    /** If valid is false, index of the first dense element of the group that does not meet the constraint */
+    unsigned invalid_elem;
+    /** Number of elements written to the packed buffer */
+    unsigned size;
+    /** Number of dense elements */
+    unsigned elems;
+    /** Number of dense elements that are not zero */
+    unsigned nonzero_elems;
+
+    /** Fraction of dense elements that are not zero */
+    constexpr float density() const
+    {
+        return elems? float(nonzero_elems) / elems : 0.0f;
+    }
+
+    /** Size of the packed data relative to the dense data */
+    constexpr float compression() const
+    {
+        return elems? float(size) / elems : 0.0f;
+    }
+};
+
+namespace detail {
+
+// Each mask describes 512b of dense data. It is followed by the non-zero bytes, and the next mask starts at the next
+// 32b boundary.
+static constexpr unsigned sparse_pack_block_bytes = 64;
+static constexpr unsigned sparse_pack_mask_bytes  = 8;
+static constexpr unsigned sparse_pack_max_bytes   = sparse_pack_mask_bytes + sparse_pack_block_bytes / 2;
+
+template <typename T>
+using sparse_pack_bits_t = std::conditional_t<sizeof(T) == 1, uint8_t, uint16_t>;
+
+} // namespace detail
+
+/**
+ * @ingroup group_memory
+ *
+ * Returns the number of elements of the largest packed buffer that sparse_pack can produce for n dense elements.
+ *
+ * @tparam T Type of the elements.
+ */
+template <ElemBaseType T>
+    requires(sizeof(T) == 1 || sizeof(T) == 2)
+constexpr unsigned sparse_pack_max_size(unsigned n)
+{
+    return n * sizeof(T) / detail::sparse_pack_block_bytes * detail::sparse_pack_max_bytes / sizeof(T);
+}
+
+/**
+ * @ingroup group_memory
+ *
+ * Converts dense data into the compressed layout read by sparse_vector_input_buffer_stream (see
+ * @ref sparse_buffer_streams_data_format).
+ *
+ * The dense data is processed in blocks of 512b. Each block is written as a 64b mask with one bit per byte, followed by
+ * the non-zero bytes of the block and padding up to the next 32b boundary. The sparsity constraint requires at most two
+ * non-zero bytes in each group of four consecutive bytes, i.e. at least two zero values in each group of four
+ * consecutive 8b values. If a group does not meet the constraint, the conversion stops and the returned result is not
+ * valid.
+ *
+ * The dense elements must be given in the order in which they are consumed by the sparse vectors. For sparse matrix
+ * multiplications, that is the column-major layout of each tile of the B matrix.
+ *
+ * The function is constexpr, so it can be used to prepare constant weights at compile time, and it does not depend on
+ * any AIE intrinsic, so it can also be used on the host.
+ *
+ * @param dense Dense data.
+ * @param n     Number of dense elements. It must be a multiple of the number of elements in 512b.
+ * @param out   Output buffer. It must be able to hold sparse_pack_max_size<T>(n) elements and be aligned to 32b.
+ *
+ * @tparam T Type of the elements.
+ */
+template <ElemBaseType T>
+    requires(sizeof(T) == 1 || sizeof(T) == 2)
+constexpr sparse_pack_result sparse_pack(const T *dense, unsigned n, T *out)
+{
+    using bits_type = detail::sparse_pack_bits_t<T>;
+
+    constexpr unsigned block_elems = detail::sparse_pack_block_bytes / sizeof(T);
+
+    sparse_pack_result ret{true, 0, 0, n, 0};
+
+    if (n % block_elems != 0) {
+        ret.valid        = false;
+        ret.invalid_elem = n - n % block_elems;
+        return ret;
+    }
+
+    // Packed bytes are stored in little-endian order into elements of type T
+    unsigned out_bytes = 0;
+    bits_type word     = 0;
+
+    auto write_byte = [&](uint8_t b) {
+        word |= bits_type(b) << (8 * (out_bytes % sizeof(T)));
+
+        if (++out_bytes % sizeof(T) == 0) {
+            out[out_bytes / sizeof(T) - 1] = __builtin_bit_cast(T, word);
+            word = 0;
+        }
+    };
+
+    for (unsigned block = 0; block < n / block_elems; ++block) {
+        std::array<uint8_t, detail::sparse_pack_block_bytes> bytes{};
+
+        for (unsigned i = 0; i < block_elems; ++i) {
+            const bits_type v = __builtin_bit_cast(bits_type, dense[block * block_elems + i]);
+
+            for (unsigned b = 0; b < sizeof(T); ++b)
+                bytes[i * sizeof(T) + b] = uint8_t(v >> (8 * b));
+
+            ret.nonzero_elems += v != 0;
+        }
+
+        uint64_t mask = 0;
+
+        for (unsigned g = 0; g < detail::sparse_pack_block_bytes; g += 4) {
+            unsigned nonzero = 0;
+
+            for (unsigned b = g; b < g + 4; ++b) {
+                if (bytes[b] != 0) {
+                    mask |= uint64_t(1) << b;
+                    ++nonzero;
+                }
+            }
+
+            if (nonzero > 2) {
+                ret.valid        = false;
+                ret.invalid_elem = block * block_elems + g / sizeof(T);
+                ret.size         = out_bytes / sizeof(T);
+                return ret;
+            }
+        }
+
+        for (unsigned b = 0; b < detail::sparse_pack_mask_bytes; ++b)
+            write_byte(uint8_t(mask >> (8 * b)));
+
+        for (unsigned b = 0; b < detail::sparse_pack_block_bytes; ++b) {
+            if (bytes[b] != 0)
+                write_byte(bytes[b]);
+        }
+
+        while (out_bytes % 4 != 0)
+            write_byte(0);
+    }
+
+    ret.size = out_bytes / sizeof(T);
+
+    return ret;
+}
+
+/**
+ * @ingroup group_memory
+ *
+ * Packed data produced by the sparse_pack overload that takes a std::array.
+ */
+template <typename T, unsigned N>
+struct sparse_packed_array
+{
+    /** Packed data, aligned for use with sparse_vector_input_buffer_stream */
+    alignas(detail::vector_decl_align) std::array<T, sparse_pack_max_size<T>(N)> data;
+    /** Summary of the conversion */
+    sparse_pack_result info;
+};
+
+/**
+ * @ingroup group_memory
+ *
+ * Converts a dense array into the compressed layout read by sparse_vector_input_buffer_stream. It is meant to be used in
+ * constant expressions, so that constant weights are packed and validated at compile time:
+ *
+ * @code
+ * constexpr auto packed = aie::sparse_pack(dense_weights);
+ * static_assert(packed.info.valid, "Weights do not meet the sparsity constraint");
+ * @endcode
+ *
+ * See the pointer-based overload for a description of the layout.
+ *
+ * @param dense Dense data.
+ *
+ * @tparam T Type of the elements.
+ * @tparam N Number of dense elements.
+ */
+template <ElemBaseType T, size_t N>
+    requires(sizeof(T) == 1 || sizeof(T) == 2)
+constexpr sparse_packed_array<T, N> sparse_pack(const std::array<T, N> &dense)
+{
+    sparse_packed_array<T, N> ret{};
+
+    ret.info = sparse_pack(dense.data(), N, ret.data.data());
+
+    return ret;
+}
+
+} // namespace aie
+
+#endif